@@ -1,13 +1,42 @@
 import os
 import struct
 import json
-from typing import List, Tuple
+from typing import Dict, List, Tuple
 from enum import Enum
 
 PKG_NAME_LEN_MAX = 256     # 最后一个字节强制为"\0"
 PKG_ID_LEN_MAX = 256       # 最后一个字节强制为"\0"
 PKG_VERSION_LEN_MAX = 256  # 最后一个字节强制为"\0"
 
+# LVGL v9 图片格式
+LV_IMAGE_HEADER_MAGIC = 0x19
+LV_IMAGE_HEADER_SIZE = 12
+LV_IMAGE_FLAGS_COMPRESSED = 0x0008
+LV_IMAGE_COMPRESS_RLE = 1
+LV_IMAGE_COMPRESS_LZ4 = 2
+RLE_MAX_COUNT = 127        # 控制字节低 7 位
+RLE_REPEAT_THRESHOLD = 3   # 至少重复多少个块才编码为重复段
+
+# 颜色格式 -> 每像素位数，用于确定 RLE 块大小
+LV_COLOR_FORMAT_BPP = {
+    0x06: 8,   # L8
+    0x07: 1,   # I1
+    0x08: 2,   # I2
+    0x09: 4,   # I4
+    0x0A: 8,   # I8
+    0x0B: 1,   # A1
+    0x0C: 2,   # A2
+    0x0D: 4,   # A4
+    0x0E: 8,   # A8
+    0x0F: 24,  # RGB888
+    0x10: 32,  # ARGB8888
+    0x11: 32,  # XRGB8888
+    0x12: 16,  # RGB565
+    0x13: 24,  # ARGB8565
+    0x14: 16,  # RGB565A8
+    0x15: 16,  # AL88
+}
+
 class ScriptType(Enum):
     APPLICATION = b"EAPK"
     WATCHFACE = b"EWPK"
@@ -31,9 +60,84 @@ def calculate_table_size(entries: List[Tuple[str, bool, int]]) -> int:
         total += 4 + name_len + 12
     return total
 
-def collect_files(directory: str) -> List[Tuple[str, bool, int]]:
-    """收集目录下所有文件和子目录"""
+def rle_compress(data: bytes, blk_size: int) -> bytes:
+    """按 LVGL lv_rle 格式压缩：
+    控制字节最高位为 1 时后跟 n 个原样块，为 0 时后跟 1 个块并重复 n 次"""
+    out = bytearray()
+    blocks = len(data) // blk_size
+    block = lambda i: data[i * blk_size:(i + 1) * blk_size]
+
+    def run_length(start: int) -> int:
+        count = 1
+        while (start + count < blocks and count < RLE_MAX_COUNT
+               and block(start + count) == block(start)):
+            count += 1
+        return count
+
+    i = 0
+    while i < blocks:
+        run = run_length(i)
+        if run >= RLE_REPEAT_THRESHOLD:
+            out.append(run)
+            out += block(i)
+            i += run
+            continue
+        # 收集原样块，直到遇到足够长的重复段
+        start = i
+        while i < blocks and i - start < RLE_MAX_COUNT:
+            if run_length(i) >= RLE_REPEAT_THRESHOLD:
+                break
+            i += 1
+        out.append(0x80 | (i - start))
+        out += data[start * blk_size:i * blk_size]
+    return bytes(out)
+
+def compress_image(raw: bytes, method: str) -> bytes:
+    """将未压缩的 LVGL bin 图片转换为压缩格式，不是图片或压缩无收益时原样返回"""
+    if len(raw) <= LV_IMAGE_HEADER_SIZE or raw[0] != LV_IMAGE_HEADER_MAGIC:
+        return raw
+    magic, cf, flags, w, h, stride, reserved = struct.unpack("<BBHHHHH", raw[:LV_IMAGE_HEADER_SIZE])
+    if flags & LV_IMAGE_FLAGS_COMPRESSED or cf not in LV_COLOR_FORMAT_BPP:
+        return raw
+    data = raw[LV_IMAGE_HEADER_SIZE:]
+
+    if method == 'rle':
+        blk_size = (LV_COLOR_FORMAT_BPP[cf] + 7) >> 3
+        # 解压以块为单位，数据长度需为块大小的整数倍
+        data += b'\0' * (-len(data) % blk_size)
+        compressed = rle_compress(data, blk_size)
+        method_id = LV_IMAGE_COMPRESS_RLE
+    else:
+        try:
+            import lz4.block
+        except ImportError:
+            raise RuntimeError("LZ4 compression requires the 'lz4' package (pip install lz4)")
+        compressed = lz4.block.compress(data, mode='high_compression', store_size=False)
+        method_id = LV_IMAGE_COMPRESS_LZ4
+
+    if len(compressed) + 12 >= len(data):
+        return raw
+    header = struct.pack("<BBHHHHH", magic, cf, flags | LV_IMAGE_FLAGS_COMPRESSED, w, h, stride, reserved)
+    return header + struct.pack("<III", method_id, len(compressed), len(data)) + compressed
+
+def load_file(path: str, compress: str) -> bytes:
+    """读取文件内容，按需压缩 .bin 图片"""
+    with open(path, 'rb') as f:
+        content = f.read()
+    if compress != 'none' and path.endswith('.bin'):
+        packed = compress_image(content, compress)
+        if len(packed) != len(content):
+            print(f"Compressed {path}: {len(content)} -> {len(packed)} bytes")
+        content = packed
+    return content
+
+def collect_files(directory: str, compress: str = 'none') -> Tuple[List[Tuple[str, bool, int]], Dict[str, bytes]]:
+    """收集目录下所有文件和子目录
+
+    压缩时同时返回已处理的文件内容（按相对路径索引），写入时直接使用，避免重复压缩
+    """
     entries = []
+    contents = {}
     for root, dirs, files in os.walk(directory):
         rel_root = os.path.relpath(root, directory)
         if rel_root == ".":
@@ -46,10 +150,14 @@ def collect_files(directory: str) -> List[Tuple[str, bool, int]]:
         for f in files:
             path = os.path.join(rel_root, f) if rel_root else f
             full_path = os.path.join(root, f)
-            size = os.path.getsize(full_path)
+            if compress != 'none':
+                contents[path] = load_file(full_path, compress)
+                size = len(contents[path])
+            else:
+                size = os.path.getsize(full_path)
             entries.append((path, False, size))
     
-    return entries
+    return entries, contents
 
 def read_manifest(input_dir: str) -> Tuple[str, str, str]:
     """从manifest.json读取包信息"""
@@ -70,9 +178,9 @@ def read_manifest(input_dir: str) -> Tuple[str, str, str]:
     
     return manifest['name'], manifest['id'], manifest['version']
 
-def pack_directory(input_dir: str, output_file: str, script_type: ScriptType):
+def pack_directory(input_dir: str, output_file: str, script_type: ScriptType, compress: str = 'none'):
     """打包目录为EAPK/EWPK文件(带包名、ID和版本号)"""
-    entries = collect_files(input_dir)
+    entries, contents = collect_files(input_dir, compress)
     if not entries:
         raise ValueError("No files found in input directory")
     
@@ -119,8 +227,8 @@ def pack_directory(input_dir: str, output_file: str, script_type: ScriptType):
         # 写入文件数据
         for (name, is_dir, size), offset in zip(entries, file_offsets):
             if not is_dir:
-                with open(os.path.join(input_dir, name), 'rb') as src:
-                    f.write(src.read())
+                data = contents.get(name)
+                f.write(data if data is not None else load_file(os.path.join(input_dir, name), 'none'))
 
 def main():
     import argparse
@@ -129,11 +237,13 @@ def main():
     parser.add_argument('output_file', help='Output package file')
     parser.add_argument('--type', choices=['app', 'watchface'], default='app',
                        help='Package type: app (EAPK) or watchface (EWPK)')
+    parser.add_argument('--compress', choices=['none', 'rle', 'lz4'], default='none',
+                       help='Compress LVGL .bin images (requires LV_USE_RLE / LV_USE_LZ4 on the device)')
     
     args = parser.parse_args()
     
     script_type = ScriptType.APPLICATION if args.type == 'app' else ScriptType.WATCHFACE
-    pack_directory(args.input_dir, args.output_file, script_type)
+    pack_directory(args.input_dir, args.output_file, script_type, args.compress)
     print(f"Successfully packed {args.input_dir} to {args.output_file}")
 
 if __name__ == '__main__':
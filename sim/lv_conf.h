@@ -0,0 +1,39 @@
+/**
+ * @file lv_conf.h
+ * @brief 模拟器的 LVGL 配置（未列出的选项使用 LVGL 默认值）
+ * @author Sab1e
+ * @date 2025-10-06
+ */
+
+#ifndef LV_CONF_H
+#define LV_CONF_H
+
+/************************** 显示 **************************/
+#define LV_COLOR_DEPTH 16
+#define LV_DEF_REFR_PERIOD 16
+
+/************************** 内存 **************************/
+// 使用内置分配器，以便通过 lv_mem_monitor 统计分配情况
+#define LV_USE_STDLIB_MALLOC LV_STDLIB_BUILTIN
+#define LV_USE_STDLIB_STRING LV_STDLIB_BUILTIN
+#define LV_USE_STDLIB_SPRINTF LV_STDLIB_BUILTIN
+#define LV_MEM_SIZE (8 * 1024 * 1024)
+
+/************************** 系统 **************************/
+#define LV_USE_OS LV_OS_NONE
+#define LV_USE_LOG 1
+#define LV_LOG_LEVEL LV_LOG_LEVEL_WARN
+#define LV_LOG_PRINTF 1
+
+/************************** 字体 **************************/
+#define LV_FONT_MONTSERRAT_14 1
+#define LV_FONT_MONTSERRAT_24 1
+#define LV_FONT_MONTSERRAT_30 1
+#define LV_FONT_DEFAULT &lv_font_montserrat_30
+
+/************************** 组件与扩展 **************************/
+#define LV_USE_SNAPSHOT 1
+#define LV_USE_TINY_TTF 1
+#define LV_USE_CANVAS 1
+
+#endif /* LV_CONF_H */
@@ -0,0 +1,28 @@
+/**
+ * @file msh.h
+ * @brief 模拟器中替代 RT-Thread msh 的接口（用于 EOS_MEM）
+ * @author Sab1e
+ * @date 2025-10-06
+ */
+
+#ifndef MSH_H
+#define MSH_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ---------------------------------------------------*/
+#include <stddef.h>
+
+/* Public function prototypes --------------------------------*/
+/**
+ * @brief 执行 shell 命令，模拟器中仅支持 list_mem（输出 LVGL 堆使用情况）
+ * @note 仅在 --verbose 时输出
+ */
+int msh_exec(char *cmd, size_t length);
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MSH_H */
@@ -0,0 +1,249 @@
+/**
+ * @file sim_main.c
+ * @brief Elena OS 无界面模拟器入口
+ * @author Sab1e
+ * @date 2025-10-06
+ *
+ * 使用模拟时间运行系统：eos_delay 直接推进 LVGL 的时钟与模拟 RTC，因此同一份输入脚本
+ * 每次回放得到相同的界面行为，可用于对比优化前后的启动时间、帧耗时与内存占用
+ */
+
+// Includes
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "lvgl.h"
+#include "elena_os_core.h"
+#include "elena_os_port.h"
+#include "elena_os_frame_stats.h"
+#include "elena_os_boot.h"
+#include "elena_os_img.h"
+#include "sim_port.h"
+#include "sim_replay.h"
+// Macros and Definitions
+#define SIM_DEFAULT_SIZE 466
+#define SIM_DEFAULT_DURATION_MS 10000
+#define SIM_DRAW_BUF_LINES 40
+/**
+ * @brief 命令行参数
+ */
+typedef struct
+{
+    const char *script;
+    const char *root;
+    int32_t width;
+    int32_t height;
+    uint32_t duration_ms;
+    bool realtime;
+    bool verbose;
+} sim_args_t;
+// Variables
+static sim_args_t args = {
+    .width = SIM_DEFAULT_SIZE,
+    .height = SIM_DEFAULT_SIZE,
+    .duration_ms = SIM_DEFAULT_DURATION_MS,
+};
+static sim_touch_t touch = {0};
+static bool booted = false;
+static uint32_t boot_tick_ms = 0;   // 启动完成时的模拟时间
+static uint64_t boot_real_us = 0;   // 启动耗时（真实时间）
+static uint64_t start_real_us = 0;
+// Function Implementations
+static void _flush_cb(lv_display_t *disp, const lv_area_t *area, uint8_t *px_map)
+{
+    EOS_UNUSED(area);
+    EOS_UNUSED(px_map);
+    lv_display_flush_ready(disp);
+}
+
+static void _touch_read_cb(lv_indev_t *indev, lv_indev_data_t *data)
+{
+    EOS_UNUSED(indev);
+    data->point.x = touch.x;
+    data->point.y = touch.y;
+    data->state = touch.pressed ? LV_INDEV_STATE_PRESSED : LV_INDEV_STATE_RELEASED;
+}
+
+static void _key_read_cb(lv_indev_t *indev, lv_indev_data_t *data)
+{
+    EOS_UNUSED(indev);
+    data->state = LV_INDEV_STATE_RELEASED;
+}
+
+/**
+ * @brief 输出报告，最后一行为便于脚本比较的 key=value 格式
+ */
+static void _report(void)
+{
+    eos_frame_stats_t stats;
+    eos_frame_stats_get(&stats);
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+    sim_large_mem_t large;
+    sim_port_large_mem_get(&large);
+    uint32_t run_ms = sim_port_tick_get() - boot_tick_ms;
+
+    printf("==================== Elena OS Simulator ====================\n");
+    printf("boot        : %llu us (first frame %u us)\n", (unsigned long long)boot_real_us,
+           eos_boot_first_frame_us());
+    printf("replay      : %u ms (simulated), %u frames\n", run_ms, stats.frames);
+    printf("render  us  : p50 %u  p95 %u  p99 %u  max %u\n",
+           stats.render.p50, stats.render.p95, stats.render.p99, stats.render.max);
+    printf("handler us  : p50 %u  p95 %u  p99 %u  max %u\n",
+           stats.handler.p50, stats.handler.p95, stats.handler.p99, stats.handler.max);
+    printf("lv_mem      : peak %zu / %zu, used %u%%, frag %u%%\n",
+           mon.max_used, mon.total_size, mon.used_pct, mon.frag_pct);
+    printf("large alloc : peak %zu, in use %zu, %u allocs / %u frees\n",
+           large.peak, large.used, large.alloc_count, large.free_count);
+    printf("SIM_RESULT boot_us=%llu first_frame_us=%u frames=%u render_p50=%u render_p95=%u render_p99=%u render_max=%u "
+           "handler_p50=%u handler_p95=%u handler_p99=%u handler_max=%u "
+           "mem_peak=%zu mem_frag=%u large_peak=%zu large_leak=%zu\n",
+           (unsigned long long)boot_real_us, eos_boot_first_frame_us(), stats.frames,
+           stats.render.p50, stats.render.p95, stats.render.p99, stats.render.max,
+           stats.handler.p50, stats.handler.p95, stats.handler.p99, stats.handler.max,
+           mon.max_used, mon.frag_pct, large.peak, large.used);
+}
+
+/**
+ * @brief 推进模拟时间并执行到达时间的输入命令
+ */
+static void _sim_advance(uint32_t ms)
+{
+    if (!booted)
+    {
+        // 第一次空闲即启动完成，此后的统计只覆盖回放过程
+        booted = true;
+        boot_real_us = eos_perf_time_get_us() - start_real_us;
+        boot_tick_ms = sim_port_tick_get();
+        eos_frame_stats_reset();
+    }
+    if (ms == 0)
+        ms = 1;
+    // 空闲等待不越过下一条输入命令，相当于输入中断提前唤醒
+    uint32_t next_ms = sim_replay_next_ms();
+    uint32_t now_ms = sim_port_tick_get() - boot_tick_ms;
+    if (args.script && next_ms > now_ms && next_ms - now_ms < ms)
+        ms = next_ms - now_ms;
+    if (args.realtime)
+        usleep(ms * 1000);
+    sim_port_tick_advance(ms);
+
+    now_ms = sim_port_tick_get() - boot_tick_ms;
+    bool running = args.script ? sim_replay_step(now_ms, &touch) : now_ms < args.duration_ms;
+    if (!running || now_ms >= args.duration_ms)
+    {
+        _report();
+        sim_replay_free();
+        exit(0);
+    }
+}
+
+void eos_delay(uint32_t ms)
+{
+    // 图片加载线程按真实时间运行，推进模拟时间前先等待其完成，加载视为瞬间完成
+    eos_img_async_flush();
+    _sim_advance(ms);
+}
+
+bool eos_idle_wait(uint32_t ms)
+{
+    // 有图片加载完成时相当于加载线程提前唤醒主循环，不推进模拟时间
+    if (eos_img_async_flush())
+        return true;
+    _sim_advance(ms);
+    return false;
+}
+
+static void _usage(const char *prog)
+{
+    printf("Usage: %s [options]\n"
+           "  --script <path>     input replay script (see sim_replay.h)\n"
+           "  --root <dir>        directory containing .sys/ (default: current directory)\n"
+           "  --width <px>        display width (default %d)\n"
+           "  --height <px>       display height (default %d)\n"
+           "  --duration <ms>     stop after this much simulated time (default %d)\n"
+           "  --realtime          sleep in eos_delay instead of only advancing the clock\n"
+           "  --verbose           print EOS_MEM output\n",
+           prog, SIM_DEFAULT_SIZE, SIM_DEFAULT_SIZE, SIM_DEFAULT_DURATION_MS);
+}
+
+static bool _args_parse(int argc, char **argv)
+{
+    for (int i = 1; i < argc; i++)
+    {
+        const char *arg = argv[i];
+        const char *val = i + 1 < argc ? argv[i + 1] : NULL;
+        if (strcmp(arg, "--realtime") == 0)
+            args.realtime = true;
+        else if (strcmp(arg, "--verbose") == 0)
+            args.verbose = true;
+        else if (!val)
+            return false;
+        else if (strcmp(arg, "--script") == 0)
+            args.script = argv[++i];
+        else if (strcmp(arg, "--root") == 0)
+            args.root = argv[++i];
+        else if (strcmp(arg, "--width") == 0)
+            args.width = atoi(argv[++i]);
+        else if (strcmp(arg, "--height") == 0)
+            args.height = atoi(argv[++i]);
+        else if (strcmp(arg, "--duration") == 0)
+            args.duration_ms = (uint32_t)strtoul(argv[++i], NULL, 10);
+        else
+            return false;
+    }
+    return args.width > 0 && args.height > 0;
+}
+
+int main(int argc, char **argv)
+{
+    if (!_args_parse(argc, argv))
+    {
+        _usage(argv[0]);
+        return 1;
+    }
+    if (args.root && chdir(args.root) != 0)
+    {
+        fprintf(stderr, "Cannot enter root directory: %s\n", args.root);
+        return 1;
+    }
+    if (args.script && !sim_replay_load(args.script))
+        return 1;
+    if (args.script)
+        args.duration_ms = UINT32_MAX; // 由脚本的 end 命令或最后一条命令结束
+    sim_port_set_verbose(args.verbose);
+    start_real_us = eos_perf_time_get_us();
+
+    lv_init();
+    lv_tick_set_cb(sim_port_tick_get);
+
+    // 无界面显示器：只渲染到缓冲区，不输出
+    lv_display_t *disp = lv_display_create(args.width, args.height);
+    size_t buf_size = (size_t)args.width * SIM_DRAW_BUF_LINES * lv_color_format_get_size(lv_display_get_color_format(disp));
+    void *buf = malloc(buf_size);
+    if (!buf)
+        return 1;
+    lv_display_set_buffers(disp, buf, NULL, buf_size, LV_DISPLAY_RENDER_MODE_PARTIAL);
+    lv_display_set_flush_cb(disp, _flush_cb);
+
+    lv_indev_t *touch_indev = lv_indev_create();
+    lv_indev_set_type(touch_indev, LV_INDEV_TYPE_POINTER);
+    lv_indev_set_read_cb(touch_indev, _touch_read_cb);
+
+    // 系统通过键盘输入设备获取按键组
+    lv_indev_t *key_indev = lv_indev_create();
+    lv_indev_set_type(key_indev, LV_INDEV_TYPE_KEYPAD);
+    lv_indev_set_read_cb(key_indev, _key_read_cb);
+    lv_group_t *group = lv_group_create();
+    lv_group_set_default(group);
+    lv_indev_set_group(key_indev, group);
+
+    eos_result_t ret = eos_run();
+    // eos_run 只在出错时返回
+    fprintf(stderr, "eos_run returned %d\n", ret);
+    _report();
+    sim_replay_free();
+    return 1;
+}
@@ -0,0 +1,113 @@
+/**
+ * @file sim_mpsc_stress.c
+ * @brief MPSC 队列压力测试（独立程序）
+ * @author Sab1e
+ * @date 2025-10-06
+ *
+ * 多个生产者线程同时写入，校验没有丢失、重复，且每个生产者的消息保持顺序。
+ * 全部通过返回 0，否则返回 1。
+ */
+
+// Includes
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <inttypes.h>
+#include <pthread.h>
+#include <sched.h>
+#include "elena_os_mpsc.h"
+#include "elena_os_port.h"
+#include "elena_os_log.h"
+// Macros and Definitions
+#define MPSC_STRESS_PRODUCERS 8
+#define MPSC_STRESS_MSG_PER_PRODUCER 100000
+#define MPSC_STRESS_CAPACITY 256
+/**
+ * @brief 生产者线程参数
+ */
+typedef struct
+{
+    eos_mpsc_t *q;
+    uint32_t id;
+    uint32_t full_count;    // 队列满而重试的次数
+} mpsc_stress_producer_t;
+// Variables
+static eos_mpsc_slot_t slots[MPSC_STRESS_CAPACITY];
+static eos_mpsc_t q;
+// Function Implementations
+
+static void *_mpsc_stress_producer(void *arg)
+{
+    mpsc_stress_producer_t *p = (mpsc_stress_producer_t *)arg;
+    for (uint32_t seq = 0; seq < MPSC_STRESS_MSG_PER_PRODUCER; seq++)
+    {
+        uint32_t payload[2] = {p->id, seq};
+        while (!eos_mpsc_push(p->q, p->id, payload, sizeof(payload)))
+        {
+            p->full_count++;
+            sched_yield();
+        }
+    }
+    return NULL;
+}
+
+int main(void)
+{
+    if (eos_mpsc_init(&q, slots, MPSC_STRESS_CAPACITY) != EOS_OK)
+        return EXIT_FAILURE;
+
+    pthread_t threads[MPSC_STRESS_PRODUCERS];
+    bool started[MPSC_STRESS_PRODUCERS] = {false};
+    mpsc_stress_producer_t producers[MPSC_STRESS_PRODUCERS];
+    uint32_t next_seq[MPSC_STRESS_PRODUCERS] = {0};
+    uint32_t started_count = 0;
+    uint64_t start_us = eos_perf_time_get_us();
+    for (uint32_t i = 0; i < MPSC_STRESS_PRODUCERS; i++)
+    {
+        producers[i] = (mpsc_stress_producer_t){.q = &q, .id = i, .full_count = 0};
+        started[i] = pthread_create(&threads[i], NULL, _mpsc_stress_producer, &producers[i]) == 0;
+        if (started[i])
+            started_count++;
+        else
+            EOS_LOG_W("MPSC stress: producer %u failed to start", i);
+    }
+
+    // 只等待成功启动的生产者的消息，否则消费循环永远无法结束
+    uint32_t total = started_count * MPSC_STRESS_MSG_PER_PRODUCER;
+    uint32_t errors = 0;
+    eos_mpsc_msg_t msg;
+    for (uint32_t received = 0; received < total;)
+    {
+        if (!eos_mpsc_pop(&q, &msg))
+        {
+            sched_yield(); // 单核时让出 CPU 给生产者
+            continue;
+        }
+        received++;
+        uint32_t payload[2];
+        memcpy(payload, msg.data, sizeof(payload));
+        if (msg.size != sizeof(payload) || payload[0] != msg.code ||
+            payload[0] >= MPSC_STRESS_PRODUCERS || payload[1] != next_seq[payload[0]])
+        {
+            errors++;
+            continue;
+        }
+        next_seq[payload[0]]++;
+    }
+
+    uint32_t full_count = 0;
+    for (uint32_t i = 0; i < MPSC_STRESS_PRODUCERS; i++)
+    {
+        if (!started[i])
+            continue;
+        pthread_join(threads[i], NULL);
+        full_count += producers[i].full_count;
+    }
+    uint64_t elapsed_us = eos_perf_time_get_us() - start_us;
+    bool empty = !eos_mpsc_pop(&q, &msg);
+    bool pass = errors == 0 && empty && started_count == MPSC_STRESS_PRODUCERS;
+    EOS_LOG_I("MPSC stress: %u/%u producers x %u msgs, %" PRIu64 " us, full retries %u, errors %u, %s",
+              started_count, MPSC_STRESS_PRODUCERS, MPSC_STRESS_MSG_PER_PRODUCER,
+              elapsed_us, full_count, errors, pass ? "PASS" : "FAIL");
+    return pass ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,24 @@
+/**
+ * @file sim_perf_clock.c
+ * @brief 模拟器的性能计时（真实时间）
+ * @author Sab1e
+ * @date 2025-10-06
+ *
+ * 与 sim_port.c 分开，独立的测试程序（如 eos_mpsc_stress）也可以链接。
+ */
+
+#include "elena_os_port.h"
+
+// Includes
+#include <time.h>
+// Macros and Definitions
+
+// Variables
+
+// Function Implementations
+uint64_t eos_perf_time_get_us(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000ULL + (uint64_t)ts.tv_nsec / 1000ULL;
+}
@@ -0,0 +1,119 @@
+/**
+ * @file sim_port.c
+ * @brief 模拟器移植层（POSIX 实现的 EOS_WEAK 函数）
+ * @author Sab1e
+ * @date 2025-10-06
+ *
+ * eos_delay 由 sim_main.c 实现（推进模拟时间并回放输入）。
+ * LVGL 时钟、eos_time_get_us 与 RTC 均由模拟时间推导，只有性能计时使用真实时间
+ * （见 sim_perf_clock.c），因此时间服务等依赖时钟的行为在每次回放中一致。
+ */
+
+#include "sim_port.h"
+
+// Includes
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <pthread.h>
+#include "lvgl.h"
+#include "msh.h"
+#include "elena_os_port.h"
+// Macros and Definitions
+#define SIM_LARGE_HEADER 16 // 记录分配大小，保持 16 字节对齐
+#define SIM_RTC_EPOCH 1759305600 // 模拟时间 0 对应的 RTC 时间（2025-10-01 08:00:00 UTC）
+// Variables
+static uint32_t sim_tick_ms = 0;    // 模拟时间
+static sim_large_mem_t large_mem = {0};
+static pthread_mutex_t large_mem_lock = PTHREAD_MUTEX_INITIALIZER; // 图片加载线程也会分配
+static bool sim_verbose = false;
+// Function Implementations
+void *eos_malloc_large(size_t size)
+{
+    uint8_t *p = malloc(size + SIM_LARGE_HEADER);
+    if (!p)
+        return NULL;
+    memcpy(p, &size, sizeof(size_t));
+    pthread_mutex_lock(&large_mem_lock);
+    large_mem.alloc_count++;
+    large_mem.used += size;
+    if (large_mem.used > large_mem.peak)
+        large_mem.peak = large_mem.used;
+    pthread_mutex_unlock(&large_mem_lock);
+    return p + SIM_LARGE_HEADER;
+}
+
+void eos_free_large(void *ptr)
+{
+    if (!ptr)
+        return;
+    uint8_t *p = (uint8_t *)ptr - SIM_LARGE_HEADER;
+    size_t size;
+    memcpy(&size, p, sizeof(size_t));
+    pthread_mutex_lock(&large_mem_lock);
+    large_mem.free_count++;
+    large_mem.used -= size;
+    pthread_mutex_unlock(&large_mem_lock);
+    free(p);
+}
+
+void eos_cpu_reset(void)
+{
+    printf("[SIM] eos_cpu_reset\n");
+    exit(0);
+}
+
+eos_datetime_t eos_time_get(void)
+{
+    time_t now = (time_t)SIM_RTC_EPOCH + sim_tick_ms / 1000;
+    struct tm tm_now;
+    gmtime_r(&now, &tm_now);
+    eos_datetime_t dt = {0};
+    dt.year = tm_now.tm_year + 1900;
+    dt.month = tm_now.tm_mon + 1;
+    dt.day = tm_now.tm_mday;
+    dt.hour = tm_now.tm_hour;
+    dt.min = tm_now.tm_min;
+    dt.sec = tm_now.tm_sec;
+    dt.day_of_week = tm_now.tm_wday == 0 ? 7 : tm_now.tm_wday;
+    return dt;
+}
+
+uint64_t eos_time_get_us(void)
+{
+    return (uint64_t)sim_tick_ms * 1000ULL;
+}
+
+int msh_exec(char *cmd, size_t length)
+{
+    if (!sim_verbose || strncmp(cmd, "list_mem", length) != 0)
+        return 0;
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+    printf("[SIM] lv_mem used %zu / %zu, peak %zu, frag %d%%\n",
+           mon.total_size - mon.free_size, mon.total_size, mon.max_used, mon.frag_pct);
+    return 0;
+}
+
+void sim_port_large_mem_get(sim_large_mem_t *stats)
+{
+    pthread_mutex_lock(&large_mem_lock);
+    *stats = large_mem;
+    pthread_mutex_unlock(&large_mem_lock);
+}
+
+void sim_port_set_verbose(bool verbose)
+{
+    sim_verbose = verbose;
+}
+
+uint32_t sim_port_tick_get(void)
+{
+    return sim_tick_ms;
+}
+
+void sim_port_tick_advance(uint32_t ms)
+{
+    sim_tick_ms += ms;
+}
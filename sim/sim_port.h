@@ -0,0 +1,54 @@
+/**
+ * @file sim_port.h
+ * @brief 模拟器移植层（POSIX 实现的 EOS_WEAK 函数）
+ * @author Sab1e
+ * @date 2025-10-06
+ */
+
+#ifndef SIM_PORT_H
+#define SIM_PORT_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ---------------------------------------------------*/
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+/* Public typedefs --------------------------------------------*/
+/**
+ * @brief eos_malloc_large 的分配统计
+ */
+typedef struct
+{
+    uint32_t alloc_count;   // 累计分配次数
+    uint32_t free_count;    // 累计释放次数
+    size_t used;            // 当前占用（字节）
+    size_t peak;            // 峰值占用（字节）
+} sim_large_mem_t;
+
+/* Public function prototypes --------------------------------*/
+/**
+ * @brief 获取 eos_malloc_large 的分配统计
+ */
+void sim_port_large_mem_get(sim_large_mem_t *stats);
+/**
+ * @brief 是否输出详细日志（EOS_MEM 等）
+ */
+void sim_port_set_verbose(bool verbose);
+/**
+ * @brief 获取模拟时间（ms），同时作为 LVGL 的时钟
+ */
+uint32_t sim_port_tick_get(void);
+/**
+ * @brief 推进模拟时间
+ * @param ms 推进的时间（ms）
+ */
+void sim_port_tick_advance(uint32_t ms);
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SIM_PORT_H */
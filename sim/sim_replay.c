@@ -0,0 +1,240 @@
+/**
+ * @file sim_replay.c
+ * @brief 模拟器输入脚本回放
+ * @author Sab1e
+ * @date 2025-10-06
+ */
+
+#include "sim_replay.h"
+
+// Includes
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "elena_os_core.h"
+#include "elena_os_log.h"
+#include "elena_os_trace.h"
+// Macros and Definitions
+#define SIM_REPLAY_LINE_MAX 256
+#define SIM_REPLAY_PATH_MAX 200
+#define SIM_REPLAY_TAP_MS 50
+/**
+ * @brief 命令类型
+ */
+typedef enum
+{
+    SIM_CMD_PRESS,
+    SIM_CMD_MOVE,
+    SIM_CMD_RELEASE,
+    SIM_CMD_BTN,
+    SIM_CMD_TRACE,
+    SIM_CMD_END,
+} sim_cmd_type_t;
+/**
+ * @brief 一条命令
+ */
+typedef struct
+{
+    uint32_t time_ms;
+    uint32_t seq;           // 书写顺序，用于同一时间的命令排序
+    sim_cmd_type_t type;
+    int32_t x;
+    int32_t y;
+    eos_side_btn_state_t btn;
+    char path[SIM_REPLAY_PATH_MAX];
+} sim_cmd_t;
+// Variables
+static sim_cmd_t *cmds = NULL;
+static uint32_t cmd_count = 0;
+static uint32_t cmd_cap = 0;
+static uint32_t cmd_next = 0;
+// Function Implementations
+static sim_cmd_t *_cmd_append(uint32_t time_ms, sim_cmd_type_t type)
+{
+    if (cmd_count == cmd_cap)
+    {
+        uint32_t cap = cmd_cap ? cmd_cap * 2 : 32;
+        sim_cmd_t *p = realloc(cmds, cap * sizeof(sim_cmd_t));
+        if (!p)
+            return NULL;
+        cmds = p;
+        cmd_cap = cap;
+    }
+    sim_cmd_t *cmd = &cmds[cmd_count++];
+    memset(cmd, 0, sizeof(sim_cmd_t));
+    cmd->time_ms = time_ms;
+    cmd->seq = cmd_count;
+    cmd->type = type;
+    return cmd;
+}
+
+static bool _btn_parse(const char *name, eos_side_btn_state_t *state)
+{
+    static const struct
+    {
+        const char *name;
+        eos_side_btn_state_t state;
+    } btns[] = {
+        {"click", SIDE_BTN_CLICKED},
+        {"press", SIDE_BTN_PRESSED},
+        {"long_press", SIDE_BTN_LONG_PRESSED},
+        {"release", SIDE_BTN_RELEASED},
+        {"double_click", SIDE_BTN_DOUBLE_CLICKED},
+    };
+    for (size_t i = 0; i < sizeof(btns) / sizeof(btns[0]); i++)
+    {
+        if (strcmp(name, btns[i].name) == 0)
+        {
+            *state = btns[i].state;
+            return true;
+        }
+    }
+    return false;
+}
+
+static int _cmd_compare(const void *a, const void *b)
+{
+    const sim_cmd_t *ca = (const sim_cmd_t *)a;
+    const sim_cmd_t *cb = (const sim_cmd_t *)b;
+    if (ca->time_ms != cb->time_ms)
+        return ca->time_ms < cb->time_ms ? -1 : 1;
+    return ca->seq < cb->seq ? -1 : 1; // 同一时间保持书写顺序
+}
+
+/**
+ * @brief 解析一行命令
+ */
+static bool _line_parse(const char *line, uint32_t line_no)
+{
+    uint32_t time_ms;
+    char op[16];
+    char arg[SIM_REPLAY_PATH_MAX];
+    int32_t x, y;
+    if (sscanf(line, "%u %15s", &time_ms, op) != 2)
+        goto err;
+
+    sim_cmd_t *cmd;
+    if (strcmp(op, "press") == 0 || strcmp(op, "move") == 0 || strcmp(op, "tap") == 0)
+    {
+        if (sscanf(line, "%*u %*s %d %d", &x, &y) != 2)
+            goto err;
+        cmd = _cmd_append(time_ms, strcmp(op, "move") == 0 ? SIM_CMD_MOVE : SIM_CMD_PRESS);
+        if (!cmd)
+            return false;
+        cmd->x = x;
+        cmd->y = y;
+        if (strcmp(op, "tap") == 0)
+        {
+            cmd = _cmd_append(time_ms + SIM_REPLAY_TAP_MS, SIM_CMD_RELEASE);
+            if (!cmd)
+                return false;
+        }
+        return true;
+    }
+    if (strcmp(op, "release") == 0)
+        return _cmd_append(time_ms, SIM_CMD_RELEASE) != NULL;
+    if (strcmp(op, "end") == 0)
+        return _cmd_append(time_ms, SIM_CMD_END) != NULL;
+    if (strcmp(op, "btn") == 0)
+    {
+        eos_side_btn_state_t state;
+        if (sscanf(line, "%*u %*s %199s", arg) != 1 || !_btn_parse(arg, &state))
+            goto err;
+        cmd = _cmd_append(time_ms, SIM_CMD_BTN);
+        if (!cmd)
+            return false;
+        cmd->btn = state;
+        return true;
+    }
+    if (strcmp(op, "trace") == 0)
+    {
+        if (sscanf(line, "%*u %*s %199s", arg) != 1)
+            goto err;
+        cmd = _cmd_append(time_ms, SIM_CMD_TRACE);
+        if (!cmd)
+            return false;
+        snprintf(cmd->path, sizeof(cmd->path), "%s", arg);
+        return true;
+    }
+err:
+    EOS_LOG_E("Replay syntax error at line %u: %s", line_no, line);
+    return false;
+}
+
+bool sim_replay_load(const char *path)
+{
+    FILE *fp = fopen(path, "r");
+    if (!fp)
+    {
+        EOS_LOG_E("Open replay script failed: %s", path);
+        return false;
+    }
+    char line[SIM_REPLAY_LINE_MAX];
+    uint32_t line_no = 0;
+    bool ok = true;
+    while (ok && fgets(line, sizeof(line), fp))
+    {
+        line_no++;
+        char *p = line;
+        while (*p == ' ' || *p == '\t')
+            p++;
+        p[strcspn(p, "\r\n")] = '\0';
+        if (*p == '\0' || *p == '#')
+            continue;
+        ok = _line_parse(p, line_no);
+    }
+    fclose(fp);
+    if (!ok)
+    {
+        sim_replay_free();
+        return false;
+    }
+    // tap 生成的松开命令可能晚于后续命令，按时间排序
+    qsort(cmds, cmd_count, sizeof(sim_cmd_t), _cmd_compare);
+    EOS_LOG_I("Replay loaded: %s (%u commands)", path, cmd_count);
+    return true;
+}
+
+bool sim_replay_step(uint32_t now_ms, sim_touch_t *touch)
+{
+    while (cmd_next < cmd_count && cmds[cmd_next].time_ms <= now_ms)
+    {
+        const sim_cmd_t *cmd = &cmds[cmd_next++];
+        switch (cmd->type)
+        {
+        case SIM_CMD_PRESS:
+            touch->pressed = true;
+            /* fall through */
+        case SIM_CMD_MOVE:
+            touch->x = cmd->x;
+            touch->y = cmd->y;
+            break;
+        case SIM_CMD_RELEASE:
+            touch->pressed = false;
+            break;
+        case SIM_CMD_BTN:
+            eos_side_btn_handler(cmd->btn);
+            break;
+        case SIM_CMD_TRACE:
+            eos_trace_dump(cmd->path);
+            break;
+        case SIM_CMD_END:
+            return false;
+        }
+    }
+    return cmd_next < cmd_count;
+}
+
+uint32_t sim_replay_next_ms(void)
+{
+    return cmd_next < cmd_count ? cmds[cmd_next].time_ms : UINT32_MAX;
+}
+
+void sim_replay_free(void)
+{
+    free(cmds);
+    cmds = NULL;
+    cmd_count = 0;
+    cmd_cap = 0;
+    cmd_next = 0;
+}
@@ -0,0 +1,71 @@
+/**
+ * @file sim_replay.h
+ * @brief 模拟器输入脚本回放
+ * @author Sab1e
+ * @date 2025-10-06
+ *
+ * 脚本为文本文件，每行一条命令，`#` 开头为注释：
+ *
+ *     <时间 ms> press <x> <y>      按下触摸屏
+ *     <时间 ms> move <x> <y>       拖动到指定位置
+ *     <时间 ms> release            松开触摸屏
+ *     <时间 ms> tap <x> <y>        按下并在 50ms 后松开
+ *     <时间 ms> btn <click|press|long_press|release|double_click>  侧边按钮
+ *     <时间 ms> trace <path>       导出性能追踪记录
+ *     <时间 ms> end                结束回放并输出报告
+ *
+ * 时间为从启动完成（首次进入主循环）起的模拟时间
+ */
+
+#ifndef SIM_REPLAY_H
+#define SIM_REPLAY_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ---------------------------------------------------*/
+#include <stdint.h>
+#include <stdbool.h>
+
+/* Public typedefs --------------------------------------------*/
+/**
+ * @brief 触摸屏状态
+ */
+typedef struct
+{
+    bool pressed;
+    int32_t x;
+    int32_t y;
+} sim_touch_t;
+
+/* Public function prototypes --------------------------------*/
+/**
+ * @brief 加载输入脚本
+ * @param path 脚本路径
+ * @return true 成功
+ * @return false 文件不存在或格式错误
+ */
+bool sim_replay_load(const char *path);
+/**
+ * @brief 执行到达时间的命令
+ * @param now_ms 从启动完成起的模拟时间
+ * @param touch 触摸屏状态，命令执行后更新
+ * @return true 继续回放
+ * @return false 已执行 end 命令或脚本结束
+ */
+bool sim_replay_step(uint32_t now_ms, sim_touch_t *touch);
+/**
+ * @brief 获取下一条命令的时间
+ * @return uint32_t 从启动完成起的模拟时间，没有剩余命令时返回 UINT32_MAX
+ */
+uint32_t sim_replay_next_ms(void);
+/**
+ * @brief 释放脚本
+ */
+void sim_replay_free(void);
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SIM_REPLAY_H */
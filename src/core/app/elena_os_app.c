@@ -19,8 +19,10 @@
 #include "elena_os_log.h"
 #include "elena_os_pkg_mgr.h"
 #include "elena_os_event.h"
+#include "elena_os_img.h"
 #include "script_engine_core.h"
 #include "cJSON.h"
+#include "elena_os_boot.h"
 // Macros and Definitions
 #define EOS_APP_LIST_DEFAULT_CAPACITY 1 // 列表默认容量大小
 /**
@@ -380,6 +382,7 @@ eos_result_t _eos_app_list_refresh()
 eos_result_t eos_app_install(const char *eapk_path)
 {
     EOS_CHECK_PTR_RETURN_VAL(eapk_path, EOS_ERR_VAR_NULL);
+    eos_boot_wait();
     // 获取软件包头
     eos_pkg_header_t header;
     if (eos_pkg_read_header(eapk_path, &header) != EOS_OK)
@@ -441,6 +444,14 @@ eos_result_t eos_app_install(const char *eapk_path)
         eos_rm_recursive(path);
         return EOS_FAILED;
     }
+    // 生成系统界面所需尺寸的图标，避免运行时缩放
+    char icon_path[PATH_MAX];
+    snprintf(icon_path, sizeof(icon_path), "%s/" EOS_APP_ICON_FILE_NAME, path);
+    if (eos_is_file(icon_path))
+    {
+        eos_img_variant_generate(icon_path, EOS_IMG_SIZE_APP_ICON, EOS_IMG_SIZE_APP_ICON);
+        eos_img_variant_generate(icon_path, EOS_IMG_SIZE_LIST_ICON, EOS_IMG_SIZE_LIST_ICON);
+    }
     // 添加到顺序列表
     _eos_app_order_add(header.pkg_id);
     _eos_app_list_refresh();
@@ -454,6 +465,7 @@ eos_result_t eos_app_install(const char *eapk_path)
 eos_result_t eos_app_uninstall(const char *app_id)
 {
     EOS_LOG_D("Uninstall: %s", app_id);
+    eos_boot_wait();
     // 卸载应用程序
     eos_event_broadcast(eos_event_get_code(EOS_EVENT_APP_DELETED), (void *)app_id);
 
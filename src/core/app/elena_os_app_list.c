@@ -23,6 +23,7 @@
 #include "script_engine_core.h"
 #include "elena_os_sys.h"
 #include "elena_os_event.h"
+#include "elena_os_boot.h"
 // Macros and Definitions
 
 // Variables
@@ -90,20 +91,37 @@ static void _app_list_settings_cb(lv_event_t *e)
 static lv_obj_t *_app_icon_create(lv_obj_t *parent, const char *icon_path)
 {
     lv_obj_t *app_icon = lv_image_create(parent);
-    lv_obj_set_size(app_icon, 100, 100);
+    lv_obj_set_size(app_icon, EOS_IMG_SIZE_APP_ICON, EOS_IMG_SIZE_APP_ICON);
     lv_obj_set_style_shadow_width(app_icon, 0, 0);
     lv_obj_set_style_margin_all(app_icon, 0, 0);
     lv_obj_set_style_pad_all(app_icon, 0, 0);
     // lv_obj_remove_flag(app_icon, LV_OBJ_FLAG_CLICK_FOCUSABLE);
     lv_obj_add_flag(app_icon, LV_OBJ_FLAG_CLICKABLE);
     lv_obj_add_flag(app_icon, LV_OBJ_FLAG_CLICK_FOCUSABLE);
-    eos_img_set_src(app_icon, icon_path);
-    eos_img_set_size(app_icon, 100, 100);
+    eos_img_set_src_sized_async(app_icon, icon_path, EOS_IMG_SIZE_APP_ICON, EOS_IMG_SIZE_APP_ICON);
     lv_obj_center(app_icon);
 
     return app_icon;
 }
 
+static void _app_icon_delete_cb(lv_event_t *e)
+{
+    free(lv_event_get_user_data(e));
+}
+
+/**
+ * @brief 绑定应用图标的点击回调，应用 id 复制一份随图标释放
+ * @note 页面会被保留复用，不能引用 JSON 或应用列表中的字符串
+ */
+static void _app_icon_bind(lv_obj_t *app_icon, const char *app_id)
+{
+    char *id = (char *)eos_strdup(app_id);
+    EOS_CHECK_PTR_RETURN(id);
+    lv_obj_add_event_cb(app_icon, _app_list_icon_clicked_cb, LV_EVENT_CLICKED, id);
+    lv_obj_add_event_cb(app_icon, _app_icon_delete_cb, LV_EVENT_DELETE, id);
+    eos_app_obj_auto_delete(app_icon, app_id);
+}
+
 static void _app_installed_cb(lv_event_t *e)
 {
     lv_obj_t *parent = lv_event_get_target(e);
@@ -118,8 +136,7 @@ static void _app_installed_cb(lv_event_t *e)
     }
     lv_obj_t *app_icon = _app_icon_create(parent, icon_path);
     EOS_LOG_D("app_icon ptr = %p", app_icon);
-    lv_obj_add_event_cb(app_icon, _app_list_icon_clicked_cb, LV_EVENT_CLICKED, (void *)installed_app_id);
-    eos_app_obj_auto_delete(app_icon, installed_app_id);
+    _app_icon_bind(app_icon, installed_app_id);
 }
 
 static void _container_delete_cb(lv_event_t *e)
@@ -132,10 +149,14 @@ static void _container_delete_cb(lv_event_t *e)
 // 修改应用列表创建函数，按JSON顺序显示应用
 void eos_app_list_create(void)
 {
-    // 创建新的页面用于绘制应用列表
-    lv_obj_t *scr = eos_nav_scr_create();
-    lv_screen_load(scr);
-    
+    // 创建新的页面用于绘制应用列表，返回后再次进入时直接复用
+    bool reused = false;
+    lv_obj_t *scr = eos_nav_scr_create_keyed("app_list", &reused);
+    EOS_CHECK_PTR_RETURN(scr);
+    if (reused)
+        return;
+    eos_boot_wait();
+
     // 加载应用顺序
     char *json_str = eos_read_file(EOS_APP_LIST_APP_ORDER_PATH);
     cJSON *app_order = json_str ? cJSON_Parse(json_str) : NULL;
@@ -187,8 +208,7 @@ void eos_app_list_create(void)
                     memcpy(icon_path, EOS_IMG_APP, sizeof(EOS_IMG_APP));
                 }
                 lv_obj_t *app_icon = _app_icon_create(container, icon_path);
-                lv_obj_add_event_cb(app_icon, _app_list_icon_clicked_cb, LV_EVENT_CLICKED, (void *)app_id);
-                eos_app_obj_auto_delete(app_icon, app_id);
+                _app_icon_bind(app_icon, app_id);
             }
         }
         cJSON_Delete(app_order);
@@ -204,8 +224,7 @@ void eos_app_list_create(void)
                 memcpy(icon_path, EOS_IMG_APP, sizeof(EOS_IMG_APP));
             }
             lv_obj_t *app_icon = _app_icon_create(container, icon_path);
-            lv_obj_add_event_cb(app_icon, _app_list_icon_clicked_cb, LV_EVENT_CLICKED, (void *)app_id);
-            eos_app_obj_auto_delete(app_icon, app_id);
+            _app_icon_bind(app_icon, app_id);
         }
     }
 }
\ No newline at end of file
@@ -10,11 +10,26 @@
 // Includes
 #include <stdio.h>
 #include <stdlib.h>
+#include "elena_os_img.h"
+#include "elena_os_log.h"
+#include "elena_os_port.h"
 
 // Macros and Definitions
 // #define DEBUG_BLOCKER_VISIBLE
+#define SCR_TRANSITION_RESOLUTION 1024 // 页面切换动画的进度精度
+/**
+ * @brief 快照页面切换
+ */
+typedef struct
+{
+    lv_obj_t *new_scr;
+    lv_obj_t *snapshot;         // 旧页面的快照图像
+    eos_anim_scr_load_t type;
+    bool running;
+} eos_scr_transition_t;
 // Variables
 static lv_obj_t *blocker;
+static eos_scr_transition_t scr_transition;
 // Function Implementations
 
 void eos_anim_blocker_show(void){
@@ -196,3 +211,183 @@ void *eos_anim_get_user_data(eos_anim_t *anim)
 {
     return anim ? anim->user_data : NULL;
 }
+
+/************************** 页面切换 **************************/
+
+static void _scr_transition_snapshot_delete_cb(lv_event_t *e)
+{
+    lv_draw_buf_t *draw_buf = (lv_draw_buf_t *)lv_event_get_user_data(e);
+    eos_img_snapshot_free(draw_buf);
+}
+
+static void _scr_transition_new_scr_delete_cb(lv_event_t *e);
+
+/**
+ * @brief 结束页面切换，删除快照并复位新页面
+ */
+static void _scr_transition_finish(void)
+{
+    if (!scr_transition.running)
+        return;
+    scr_transition.running = false;
+    lv_anim_delete(&scr_transition, NULL);
+    if (scr_transition.snapshot)
+    {
+        lv_obj_delete(scr_transition.snapshot);
+        scr_transition.snapshot = NULL;
+    }
+    if (scr_transition.new_scr)
+    {
+        lv_obj_remove_event_cb(scr_transition.new_scr, _scr_transition_new_scr_delete_cb);
+        lv_obj_set_pos(scr_transition.new_scr, 0, 0);
+        scr_transition.new_scr = NULL;
+    }
+}
+
+/**
+ * @brief 新页面在动画期间被删除
+ */
+static void _scr_transition_new_scr_delete_cb(lv_event_t *e)
+{
+    EOS_UNUSED(e);
+    scr_transition.new_scr = NULL;
+    _scr_transition_finish();
+}
+
+/**
+ * @brief 动画进度 0~SCR_TRANSITION_RESOLUTION，只移动快照与新页面
+ */
+static void _scr_transition_exec_cb(void *var, int32_t v)
+{
+    EOS_UNUSED(var);
+    int32_t w = lv_display_get_horizontal_resolution(NULL);
+    int32_t offset = (int32_t)(((int64_t)w * v) / SCR_TRANSITION_RESOLUTION);
+    lv_obj_t *snapshot = scr_transition.snapshot;
+    lv_obj_t *new_scr = scr_transition.new_scr;
+    switch (scr_transition.type)
+    {
+    case EOS_ANIM_SCR_LOAD_OVER_LEFT:
+        lv_obj_set_x(new_scr, w - offset);
+        break;
+    case EOS_ANIM_SCR_LOAD_OVER_RIGHT:
+        lv_obj_set_x(new_scr, offset - w);
+        break;
+    case EOS_ANIM_SCR_LOAD_MOVE_LEFT:
+        lv_obj_set_x(snapshot, -offset);
+        lv_obj_set_x(new_scr, w - offset);
+        break;
+    case EOS_ANIM_SCR_LOAD_MOVE_RIGHT:
+        lv_obj_set_x(snapshot, offset);
+        lv_obj_set_x(new_scr, offset - w);
+        break;
+    case EOS_ANIM_SCR_LOAD_OUT_LEFT:
+        lv_obj_set_x(snapshot, -offset);
+        break;
+    case EOS_ANIM_SCR_LOAD_OUT_RIGHT:
+        lv_obj_set_x(snapshot, offset);
+        break;
+    case EOS_ANIM_SCR_LOAD_FADE_OUT:
+        lv_obj_set_style_image_opa(snapshot, LV_OPA_COVER - (lv_opa_t)((LV_OPA_COVER * v) / SCR_TRANSITION_RESOLUTION), 0);
+        break;
+    default:
+        break;
+    }
+}
+
+static void _scr_transition_completed_cb(lv_anim_t *a)
+{
+    EOS_UNUSED(a);
+    _scr_transition_finish();
+}
+
+/**
+ * @brief 旧页面在新页面之上的动画类型
+ */
+static bool _scr_transition_snapshot_on_top(eos_anim_scr_load_t type)
+{
+    return type == EOS_ANIM_SCR_LOAD_OUT_LEFT ||
+           type == EOS_ANIM_SCR_LOAD_OUT_RIGHT ||
+           type == EOS_ANIM_SCR_LOAD_FADE_OUT;
+}
+
+/**
+ * @brief LVGL 自带动画的对应类型，快照失败时使用
+ */
+static lv_screen_load_anim_t _scr_transition_fallback(eos_anim_scr_load_t type)
+{
+    switch (type)
+    {
+    case EOS_ANIM_SCR_LOAD_OVER_LEFT:
+        return LV_SCR_LOAD_ANIM_OVER_LEFT;
+    case EOS_ANIM_SCR_LOAD_OVER_RIGHT:
+        return LV_SCR_LOAD_ANIM_OVER_RIGHT;
+    case EOS_ANIM_SCR_LOAD_MOVE_LEFT:
+        return LV_SCR_LOAD_ANIM_MOVE_LEFT;
+    case EOS_ANIM_SCR_LOAD_MOVE_RIGHT:
+        return LV_SCR_LOAD_ANIM_MOVE_RIGHT;
+    case EOS_ANIM_SCR_LOAD_OUT_LEFT:
+        return LV_SCR_LOAD_ANIM_OUT_LEFT;
+    case EOS_ANIM_SCR_LOAD_OUT_RIGHT:
+        return LV_SCR_LOAD_ANIM_OUT_RIGHT;
+    case EOS_ANIM_SCR_LOAD_FADE_OUT:
+        return LV_SCR_LOAD_ANIM_FADE_OUT;
+    default:
+        return LV_SCR_LOAD_ANIM_NONE;
+    }
+}
+
+void eos_anim_scr_load(lv_obj_t *new_scr, eos_anim_scr_load_t type, uint32_t duration, bool auto_del)
+{
+    EOS_CHECK_PTR_RETURN(new_scr);
+    _scr_transition_finish();
+
+    lv_obj_t *old_scr = lv_screen_active();
+    if (type == EOS_ANIM_SCR_LOAD_NONE || duration == 0 || !old_scr || old_scr == new_scr)
+    {
+        lv_screen_load(new_scr);
+        if (auto_del && old_scr && old_scr != new_scr)
+            lv_obj_delete(old_scr);
+        return;
+    }
+
+    // 旧页面只渲染一次
+    lv_draw_buf_t *draw_buf = eos_img_snapshot_take(old_scr, LV_COLOR_FORMAT_NATIVE);
+    if (!draw_buf)
+    {
+        EOS_LOG_W("Transition snapshot failed, using live animation");
+        lv_screen_load_anim(new_scr, _scr_transition_fallback(type), duration, 0, auto_del);
+        return;
+    }
+
+    // 覆盖类动画快照放在底层，新页面移动时露出；移出类动画放在顶层（位于标题栏之下）
+    bool on_top = _scr_transition_snapshot_on_top(type);
+    lv_obj_t *snapshot = lv_image_create(on_top ? lv_layer_top() : lv_layer_bottom());
+    lv_obj_remove_style_all(snapshot);
+    lv_image_set_src(snapshot, draw_buf);
+    lv_obj_set_pos(snapshot, 0, 0);
+    lv_obj_remove_flag(snapshot, LV_OBJ_FLAG_CLICKABLE);
+    lv_obj_add_event_cb(snapshot, _scr_transition_snapshot_delete_cb, LV_EVENT_DELETE, draw_buf);
+    if (on_top)
+        lv_obj_move_background(snapshot);
+
+    lv_screen_load(new_scr);
+    if (auto_del)
+        lv_obj_delete(old_scr);
+
+    scr_transition.new_scr = new_scr;
+    scr_transition.snapshot = snapshot;
+    scr_transition.type = type;
+    scr_transition.running = true;
+    lv_obj_add_event_cb(new_scr, _scr_transition_new_scr_delete_cb, LV_EVENT_DELETE, NULL);
+    _scr_transition_exec_cb(&scr_transition, 0);
+
+    lv_anim_t a;
+    lv_anim_init(&a);
+    lv_anim_set_var(&a, &scr_transition);
+    lv_anim_set_exec_cb(&a, _scr_transition_exec_cb);
+    lv_anim_set_values(&a, 0, SCR_TRANSITION_RESOLUTION);
+    lv_anim_set_duration(&a, duration);
+    lv_anim_set_path_cb(&a, lv_anim_path_ease_out);
+    lv_anim_set_completed_cb(&a, _scr_transition_completed_cb);
+    lv_anim_start(&a);
+}
\ No newline at end of file
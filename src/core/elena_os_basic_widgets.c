@@ -22,9 +22,9 @@
 #include "elena_os_theme.h"
 #include "script_engine_nav.h"
 #include "elena_os_port.h"
+#include "elena_os_time.h"
 // Macros and Definitions
 #define APP_HEADER_HEIGHT 120
-#define APP_HEADER_CLOCK_UPDATE_PERIOD_MS 60000 // 一分钟
 
 #define APP_HEADER_MARGIN_RIGHT 30
 
@@ -92,8 +92,7 @@ lv_obj_t *eos_list_add_button(lv_obj_t *list, const void *icon, const char *txt)
     if (icon)
     {
         lv_obj_t *img = lv_image_create(obj);
-        eos_img_set_src(img, icon);
-        eos_img_set_size(img, 64, 64);
+        eos_img_set_src_sized(img, icon, EOS_IMG_SIZE_LIST_ICON, EOS_IMG_SIZE_LIST_ICON);
     }
 
     if (txt)
@@ -107,26 +106,43 @@ lv_obj_t *eos_list_add_button(lv_obj_t *list, const void *icon, const char *txt)
     return obj;
 }
 
+bool eos_label_set_text_if_changed(lv_obj_t *label, const char *text)
+{
+    EOS_CHECK_PTR_RETURN_VAL(label && text, false);
+    if (strcmp(lv_label_get_text(label), text) == 0)
+        return false;
+    lv_label_set_text(label, text);
+    return true;
+}
+
+/**
+ * @brief 更新LVGL字符串，显示指定时间
+ */
+static inline void _app_header_set_clock_label(lv_obj_t *label, const eos_datetime_t *dt)
+{
+    char time_str[APP_HEADER_TIME_STR_ARRAY_MAX];
+    snprintf(time_str, sizeof(time_str), "%02d:%02d", dt->hour, dt->min);
+    eos_label_set_text_if_changed(label, time_str);
+}
+
 /**
  * @brief 更新LVGL字符串，显示当前时间
  */
 static inline void _app_header_update_clock_label(lv_obj_t *label)
 {
-    eos_datetime_t dt = eos_time_get();
-    char time_str[APP_HEADER_TIME_STR_ARRAY_MAX];
-    snprintf(time_str, sizeof(time_str), "%02d:%02d", dt.hour, dt.min);
-    lv_label_set_text(label, time_str);
+    eos_datetime_t dt = eos_time_now();
+    _app_header_set_clock_label(label, &dt);
 }
 
 /**
- * @brief 时间刷新的回调，由 LVGL 的定时器触发
+ * @brief 时间刷新的回调，由时间服务在整分钟时触发
  */
-static void clock_update_cb(lv_timer_t *timer)
+static void clock_update_cb(const eos_datetime_t *dt, void *user_data)
 {
-    lv_obj_t *label = lv_timer_get_user_data(timer);
+    lv_obj_t *label = (lv_obj_t *)user_data;
     EOS_CHECK_PTR_RETURN(label);
     // 更新显示文字
-    _app_header_update_clock_label(label);
+    _app_header_set_clock_label(label, dt);
 }
 
 /**
@@ -216,7 +232,7 @@ void eos_app_header_init(void)
     app_header->clock_label = lv_label_create(app_header->container);
     _app_header_update_clock_label(app_header->clock_label);
     lv_obj_align(app_header->clock_label, LV_ALIGN_RIGHT_MID, -APP_HEADER_MARGIN_RIGHT, -15);
-    app_header->clock_timer = lv_timer_create(clock_update_cb, APP_HEADER_CLOCK_UPDATE_PERIOD_MS, app_header->clock_label);
+    eos_time_subscribe(EOS_TIME_UNIT_MINUTE, clock_update_cb, app_header->clock_label);
 
     // 标题文字
     app_header->title_label = lv_label_create(app_header->container);
@@ -446,8 +462,7 @@ lv_obj_t *eos_row_create(lv_obj_t *parent,
     if (left_img_path)
     {
         lv_obj_t *icon = lv_image_create(row);
-        eos_img_set_src(icon, left_img_path);
-        eos_img_set_size(icon, icon_w, icon_h);
+        eos_img_set_src_sized(icon, left_img_path, icon_w, icon_h);
     }
 
     // 左边文本
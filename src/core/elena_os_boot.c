@@ -0,0 +1,183 @@
+/**
+ * @file elena_os_boot.c
+ * @brief 启动阶段计时与后台初始化
+ * @author Sab1e
+ * @date 2025-10-07
+ *
+ * 扫描应用 / 表盘目录与读取应用顺序只访问文件系统，放到后台线程中与首个表盘的
+ * 加载和渲染并行执行，访问列表前通过 eos_boot_wait 同步。
+ */
+
+#include "elena_os_boot.h"
+
+// Includes
+#include <stdio.h>
+#include <stdlib.h>
+#include <pthread.h>
+#include <limits.h>
+#include <stdatomic.h>
+#include "lvgl.h"
+#include "elena_os_log.h"
+#include "elena_os_port.h"
+#include "elena_os_trace.h"
+#include "elena_os_app.h"
+#include "elena_os_watchface.h"
+#include "elena_os_config.h"
+// Macros and Definitions
+#ifndef EOS_BOOT_WORKER_STACK_SIZE
+#define EOS_BOOT_WORKER_STACK_SIZE 16384
+#endif /* EOS_BOOT_WORKER_STACK_SIZE */
+#define BOOT_MAX_PHASES 16
+/**
+ * @brief 一个启动阶段的记录
+ */
+typedef struct
+{
+    const char *name;
+    uint32_t start_us;  // 相对 eos_boot_init 的开始时间
+    uint32_t dur_us;
+    bool worker;        // 是否在后台线程中执行
+} boot_phase_t;
+// Variables
+static boot_phase_t phases[BOOT_MAX_PHASES];
+static uint32_t phase_count = 0;
+static uint64_t boot_start_us = 0;
+static uint32_t first_frame_us = 0;
+static pthread_mutex_t boot_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t boot_cond = PTHREAD_COND_INITIALIZER;
+static atomic_bool worker_done = false;
+static _Thread_local bool on_worker = false;
+// Function Implementations
+uint64_t eos_boot_phase_begin(const char *name)
+{
+    EOS_UNUSED(name); // 关闭追踪时未使用
+    EOS_TRACE_BEGIN(name);
+    return eos_perf_time_get_us();
+}
+
+void eos_boot_phase_end(const char *name, uint64_t start_us)
+{
+    uint32_t dur_us = (uint32_t)(eos_perf_time_get_us() - start_us);
+    EOS_TRACE_END(name);
+    pthread_mutex_lock(&boot_lock);
+    if (phase_count < BOOT_MAX_PHASES)
+    {
+        boot_phase_t *phase = &phases[phase_count++];
+        phase->name = name;
+        phase->start_us = (uint32_t)(start_us - boot_start_us);
+        phase->dur_us = dur_us;
+        phase->worker = on_worker;
+    }
+    pthread_mutex_unlock(&boot_lock);
+    EOS_LOG_I("Boot phase %s: %u us%s", name, dur_us, on_worker ? " (worker)" : "");
+}
+
+static void _boot_report(void)
+{
+    EOS_LOG_I("Boot first frame: %u us", first_frame_us);
+    pthread_mutex_lock(&boot_lock);
+    for (uint32_t i = 0; i < phase_count; i++)
+    {
+        EOS_LOG_I("  %-20s start %8u us  took %8u us%s",
+                  phases[i].name, phases[i].start_us, phases[i].dur_us,
+                  phases[i].worker ? "  [worker]" : "");
+    }
+    pthread_mutex_unlock(&boot_lock);
+}
+
+static void _first_frame_cb(lv_event_t *e)
+{
+    lv_display_t *disp = (lv_display_t *)lv_event_get_current_target(e);
+    lv_display_remove_event_cb_with_user_data(disp, _first_frame_cb, NULL);
+    first_frame_us = (uint32_t)(eos_perf_time_get_us() - boot_start_us);
+    EOS_TRACE_INSTANT("first_frame");
+    _boot_report();
+}
+
+void eos_boot_init(void)
+{
+    boot_start_us = eos_perf_time_get_us();
+    lv_display_t *disp = lv_display_get_default();
+    if (disp)
+    {
+        lv_display_add_event_cb(disp, _first_frame_cb, LV_EVENT_RENDER_READY, NULL);
+    }
+    else
+    {
+        EOS_LOG_W("Boot: no display, first frame time not recorded");
+    }
+}
+
+/**
+ * @brief 后台初始化任务，只能访问文件系统，不能调用 LVGL
+ */
+static void _boot_background(void)
+{
+    EOS_BOOT_PHASE("app_init", eos_app_init());
+    EOS_BOOT_PHASE("watchface_init", eos_watchface_init());
+}
+
+static void _boot_done(void)
+{
+    pthread_mutex_lock(&boot_lock);
+    atomic_store_explicit(&worker_done, true, memory_order_release);
+    pthread_cond_broadcast(&boot_cond);
+    pthread_mutex_unlock(&boot_lock);
+}
+
+static void *_boot_worker(void *arg)
+{
+    EOS_UNUSED(arg);
+    on_worker = true;
+    _boot_background();
+    _boot_done();
+    return NULL;
+}
+
+void eos_boot_worker_start(void)
+{
+    pthread_t thread;
+    pthread_attr_t attr;
+    pthread_attr_init(&attr);
+    size_t stack_size = EOS_BOOT_WORKER_STACK_SIZE;
+#ifdef PTHREAD_STACK_MIN
+    if (stack_size < (size_t)PTHREAD_STACK_MIN)
+        stack_size = PTHREAD_STACK_MIN;
+#endif /* PTHREAD_STACK_MIN */
+    int err = pthread_attr_setstacksize(&attr, stack_size);
+    if (err != 0)
+        EOS_LOG_W("Set boot worker stack size %zu failed: %d", stack_size, err);
+    pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_DETACHED);
+    int ret = pthread_create(&thread, &attr, _boot_worker, NULL);
+    pthread_attr_destroy(&attr);
+    if (ret != 0)
+    {
+        EOS_LOG_W("Create boot worker failed: %d, running in place", ret);
+        _boot_background();
+        _boot_done();
+    }
+}
+
+void eos_boot_wait(void)
+{
+    if (atomic_load_explicit(&worker_done, memory_order_acquire))
+        return;
+    uint64_t t0 = eos_boot_phase_begin("boot_wait");
+    pthread_mutex_lock(&boot_lock);
+    while (!atomic_load_explicit(&worker_done, memory_order_acquire))
+    {
+        pthread_cond_wait(&boot_cond, &boot_lock);
+    }
+    pthread_mutex_unlock(&boot_lock);
+    eos_boot_phase_end("boot_wait", t0);
+}
+
+bool eos_boot_is_done(void)
+{
+    return atomic_load_explicit(&worker_done, memory_order_acquire);
+}
+
+uint32_t eos_boot_first_frame_us(void)
+{
+    return first_frame_us;
+}
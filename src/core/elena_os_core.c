@@ -37,10 +37,16 @@
 #include "elena_os_watchface.h"
 #include "elena_os_misc.h"
 #include "elena_os_watchface_list.h"
+#include "elena_os_watchface_layout.h"
 #include "elena_os_app_list.h"
 #include "script_engine_nav.h"
 #include "elena_os_theme.h"
 #include "elena_os_config.h"
+#include "elena_os_trace.h"
+#include "elena_os_frame_stats.h"
+#include "elena_os_boot.h"
+#include "elena_os_idle.h"
+#include "elena_os_time.h"
 // Macros and Definitions
 typedef enum
 {
@@ -62,6 +68,24 @@ static void _watchface_long_pressed_cb(lv_event_t *e)
     next_screen_type = ENTRY_WATCHFACE_LIST;
 }
 
+/**
+ * @brief 主循环的一次迭代：派发线程事件、处理 LVGL 定时器并空闲等待到下一个定时器
+ */
+static void _loop_step(void)
+{
+    eos_event_dispatch_thread();
+    uint64_t t0 = eos_perf_time_get_us();
+    EOS_TRACE_BEGIN("lv_timer_handler");
+    uint32_t d = lv_timer_handler();
+    EOS_TRACE_END("lv_timer_handler");
+    uint64_t t1 = eos_perf_time_get_us();
+    EOS_TRACE_BEGIN("idle");
+    eos_idle_sleep(d);
+    EOS_TRACE_END("idle");
+    // 忙碌与空闲使用同一时钟，CPU 占用率才有意义
+    eos_frame_stats_loop_record((uint32_t)(t1 - t0), (uint32_t)(eos_perf_time_get_us() - t1));
+}
+
 static lv_indev_t *_get_key_indev()
 {
     lv_indev_t *indev = lv_indev_get_next(NULL);
@@ -76,12 +100,28 @@ static lv_indev_t *_get_key_indev()
     EOS_LOG_W("Not found input device: key");
 }
 
+/**
+ * @brief 系统设置中的表盘是否已安装
+ */
+static bool _watchface_configured_installed(void)
+{
+    char *wf_id = eos_sys_cfg_get_string(EOS_SYS_CFG_KEY_WATCHFACE_ID, "cn.sab1e.clock");
+    if (!wf_id)
+        return false;
+    char path[PATH_MAX];
+    snprintf(path, sizeof(path), EOS_WATCHFACE_INSTALLED_DIR "%s", wf_id);
+    free((void *)wf_id);
+    return eos_is_dir(path);
+}
+
 void eos_side_btn_handler(eos_side_btn_state_t state)
 {
     static bool side_btn_processing = false;
     if (side_btn_processing)
         return;
     side_btn_processing = true;
+    // 主循环可能正在空闲等待（输入轮询已暂停），立即唤醒处理按键
+    eos_idle_wakeup();
     switch (state)
     {
     case SIDE_BTN_CLICKED:
@@ -106,8 +146,12 @@ eos_result_t eos_run()
 {
     /************************** 变量初始化 **************************/
     root_scr = lv_screen_active();
+    eos_boot_init();
     /************************** 系统组件初始化 **************************/
-    eos_event_init();
+    EOS_BOOT_PHASE("event_init", eos_event_init());
+    EOS_BOOT_PHASE("frame_stats_init", eos_frame_stats_init());
+    EOS_BOOT_PHASE("time_init", eos_time_init());
+    uint64_t theme_t0 = eos_boot_phase_begin("theme");
 #ifdef EOS_USE_FONT_TTF
     static lv_font_t *font_ttf;
     font_ttf = lv_tiny_ttf_create_file(argv[1], 24); // 24px 大小
@@ -130,12 +174,13 @@ eos_result_t eos_run()
                   lv_palette_main(LV_PALETTE_RED),
                   &lv_font_montserrat_30);
 #endif /* EOS_USE_FONT_TTF */
-    eos_app_init();
-    eos_watchface_init();
-    eos_sys_init();
-    eos_lang_init();
+    eos_boot_phase_end("theme", theme_t0);
+    EOS_BOOT_PHASE("sys_init", eos_sys_init());
+    // 应用 / 表盘目录扫描在后台执行，不阻塞首个表盘
+    eos_boot_worker_start();
+    EOS_BOOT_PHASE("lang_init", eos_lang_init());
     // 加载导航
-    eos_nav_init(root_scr);
+    EOS_BOOT_PHASE("nav_init", eos_nav_init(root_scr));
     eos_lang_set(LANG_EN);
 
     lv_indev_t *indev = _get_key_indev();
@@ -149,18 +194,23 @@ eos_result_t eos_run()
         EOS_LOG_W("Input device not found");
     }
 
-    if (eos_watchface_list_size() == 0)
+    // 配置的表盘已安装时直接加载，否则等待表盘列表扫描完成
+    if (!_watchface_configured_installed())
     {
-        EOS_LOG_E("Watchface not found");
-        while (1)
+        eos_boot_wait();
+        if (eos_watchface_list_size() == 0)
         {
-            if (eos_watchface_list_size() > 0)
-                break;
-            eos_delay(5000);
+            EOS_LOG_E("Watchface not found");
+            while (1)
+            {
+                if (eos_watchface_list_size() > 0)
+                    break;
+                eos_delay(5000);
+            }
         }
     }
     /************************** 基础部件初始化 **************************/
-    eos_app_header_init();
+    EOS_BOOT_PHASE("app_header_init", eos_app_header_init());
 
     /************************** 系统启动 **************************/
     // 加载表盘
@@ -192,13 +242,22 @@ eos_result_t eos_run()
         char script_path[PATH_MAX];
         snprintf(script_path, sizeof(script_path), EOS_WATCHFACE_INSTALLED_DIR "%s/" EOS_WATCHFACE_SCRIPT_ENTRY_FILE_NAME,
                  wf_id);
-        free((void *)wf_id);
+        // 仅当存在 main.js 时才启动脚本虚拟机，否则使用声明式布局
+        bool use_layout = false;
         if (!eos_is_file(script_path))
         {
-            EOS_LOG_E("Can't find script: %s", script_path);
-            return -EOS_FAILED;
+            if (!eos_watchface_layout_exists(wf_id))
+            {
+                EOS_LOG_E("Can't find script or layout: %s", script_path);
+                free((void *)wf_id);
+                return -EOS_FAILED;
+            }
+            use_layout = true;
+        }
+        else
+        {
+            pkg.script_str = eos_read_file(script_path);
         }
-        pkg.script_str = eos_read_file(script_path);
 
         memcpy(&script_pkg, &pkg, sizeof(script_pkg_t));
 
@@ -207,14 +266,38 @@ eos_result_t eos_run()
         if (!msg_list)
         {
             EOS_LOG_E("Create msg_list failed");
+            free((void *)wf_id);
             return -SE_FAILED;
         }
         // 设置上拉面板
 
         // 设置长按回调 进入 watchface list 使用普通 nav 导航
         lv_obj_add_event_cb(root_scr, _watchface_long_pressed_cb, LV_EVENT_LONG_PRESSED, NULL);
-        // 正式运行表盘脚本
-        script_engine_result_t ret = script_engine_run(&script_pkg);
+        script_engine_result_t ret = SE_OK;
+        if (use_layout)
+        {
+            // 原生渲染声明式表盘，直到请求切换页面
+            if (!eos_watchface_layout_create(root_scr, wf_id))
+            {
+                ret = -SE_FAILED;
+            }
+            else
+            {
+                while (next_screen_type == ENTRY_NULL)
+                {
+                    _loop_step();
+                }
+            }
+        }
+        else
+        {
+            // 正式运行表盘脚本，首次运行时截取缩略图
+            eos_watchface_snapshot_schedule(wf_id, root_scr);
+            eos_idle_input_resume();
+            ret = script_engine_run(&script_pkg);
+            eos_watchface_snapshot_cancel();
+        }
+        free((void *)wf_id);
         eos_pkg_free(&script_pkg);
         lv_obj_clean(root_scr);
         if (ret != SE_OK)
@@ -238,11 +321,11 @@ eos_result_t eos_run()
         }
         while (1)
         {
-            uint32_t d = lv_timer_handler();
-            eos_delay(d);
+            _loop_step();
             if (script_engine_get_state() == SCRIPT_STATE_READY)
             {
                 script_engine_nav_init(lv_screen_active());
+                eos_idle_input_resume();
                 script_engine_result_t ret = script_engine_run(&script_pkg);
                 eos_pkg_free(&script_pkg);
                 if (ret != SE_OK)
@@ -10,47 +10,163 @@
 // Includes
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include "lvgl.h"
 #include "elena_os_log.h"
+#include "elena_os_config.h"
+#include "elena_os_port.h"
+#include "elena_os_trace.h"
 // Macros and Definitions
+#define EVENT_BUCKET_INIT_CAP 4
+#ifndef EOS_EVENT_QUEUE_SIZE
+#define EOS_EVENT_QUEUE_SIZE 16
+#endif /* EOS_EVENT_QUEUE_SIZE */
+#ifndef EOS_EVENT_THREAD_QUEUE_SIZE
+#define EOS_EVENT_THREAD_QUEUE_SIZE 64
+#endif /* EOS_EVENT_THREAD_QUEUE_SIZE */
 /**
- * @brief 事件回调节点结构
+ * @brief 事件订阅
  */
-typedef struct _event_node_t
+typedef struct
 {
-    lv_obj_t *obj;
-    lv_event_code_t event;
+    lv_obj_t *obj;          // 为 NULL 表示已在派发期间被移除，等待回收
     lv_event_cb_t cb;
     void *user_data;
-    struct _event_node_t *next;
-} event_node_t;
+    uint32_t bucket;        // 所在桶的索引
+    uint32_t index;         // 在桶中的位置，用于 O(1) 移除
+} event_sub_t;
+/**
+ * @brief 同一事件码的订阅者
+ */
+typedef struct
+{
+    lv_event_code_t event;
+    event_sub_t **subs;
+    uint32_t count;
+    uint32_t cap;
+    uint16_t dispatching;   // 正在派发的层数，派发期间只标记移除，结束后再回收
+    bool has_removed;
+} event_bucket_t;
+/**
+ * @brief 投递的事件
+ */
+typedef struct
+{
+    lv_event_code_t event;
+    void *param;
+} event_post_t;
 // Variables
-static event_node_t *event_list_head = NULL; // 事件链表头
+static event_bucket_t *event_buckets = NULL; // 按事件码分组的订阅者
+static uint32_t event_bucket_count = 0;
+static uint32_t event_bucket_cap = 0;
+static event_post_t event_queue[EOS_EVENT_QUEUE_SIZE]; // 按投递顺序排列，同一事件只保留一份
+static uint32_t event_queue_count = 0;
+static lv_timer_t *event_queue_timer = NULL;
+static eos_mpsc_slot_t event_thread_slots[EOS_EVENT_THREAD_QUEUE_SIZE];
+static eos_mpsc_t event_thread_queue;                  // 其他线程投递的事件
+static uint32_t thread_call_code = 0;                  // eos_event_call_from_thread 使用的事件码
+/**
+ * @brief eos_event_call_from_thread 的消息数据
+ */
+typedef struct
+{
+    eos_thread_call_cb_t cb;
+    void *user_data;
+} thread_call_t;
 /************************** 事件定义 **************************/
 static uint32_t event_list[EOS_EVENT_MAX_NUMBER] = {0};
 // Function Implementations
 /**
- * @brief 对象删除回调
+ * @brief 查找事件码对应的桶
+ * @return int32_t 桶索引，不存在返回 -1
  */
-static void _obj_delete_cb(lv_event_t *e)
+static int32_t _event_bucket_find(lv_event_code_t event)
 {
-    lv_obj_t *obj = lv_event_get_target(e);
+    for (uint32_t i = 0; i < event_bucket_count; i++)
+    {
+        if (event_buckets[i].event == event)
+            return (int32_t)i;
+    }
+    return -1;
+}
 
-    // 移除该对象的所有回调
-    event_node_t **curr = &event_list_head;
-    while (*curr)
+/**
+ * @brief 查找或创建事件码对应的桶
+ */
+static int32_t _event_bucket_get(lv_event_code_t event)
+{
+    int32_t bi = _event_bucket_find(event);
+    if (bi >= 0)
+        return bi;
+    if (event_bucket_count == event_bucket_cap)
     {
-        if ((*curr)->obj == obj)
-        {
-            event_node_t *tmp = *curr;
-            *curr = (*curr)->next;
-            lv_free(tmp);
-        }
-        else
+        uint32_t cap = event_bucket_cap ? event_bucket_cap * 2 : EVENT_BUCKET_INIT_CAP;
+        event_bucket_t *buckets = lv_realloc(event_buckets, cap * sizeof(event_bucket_t));
+        if (!buckets)
+            return -1;
+        event_buckets = buckets;
+        event_bucket_cap = cap;
+    }
+    event_bucket_t *b = &event_buckets[event_bucket_count];
+    lv_memzero(b, sizeof(event_bucket_t));
+    b->event = event;
+    return (int32_t)event_bucket_count++;
+}
+
+/**
+ * @brief 回收派发期间被移除的订阅
+ */
+static void _event_bucket_compact(event_bucket_t *b)
+{
+    uint32_t n = 0;
+    for (uint32_t i = 0; i < b->count; i++)
+    {
+        event_sub_t *sub = b->subs[i];
+        if (!sub->obj)
         {
-            curr = &(*curr)->next;
+            lv_free(sub);
+            continue;
         }
+        sub->index = n;
+        b->subs[n++] = sub;
+    }
+    b->count = n;
+    b->has_removed = false;
+}
+
+/**
+ * @brief 从桶中移除订阅，与最后一个订阅交换位置
+ */
+static void _event_sub_remove(event_sub_t *sub)
+{
+    event_bucket_t *b = &event_buckets[sub->bucket];
+    if (b->dispatching)
+    {
+        sub->obj = NULL;
+        b->has_removed = true;
+        return;
     }
+    event_sub_t *last = b->subs[--b->count];
+    b->subs[sub->index] = last;
+    last->index = sub->index;
+    lv_free(sub);
+}
+
+/**
+ * @brief 对象删除回调
+ */
+static void _obj_delete_cb(lv_event_t *e)
+{
+    // 每个订阅单独注册删除回调，直接定位到订阅本身
+    event_sub_t *sub = (event_sub_t *)lv_event_get_user_data(e);
+    if (sub->obj)
+        _event_sub_remove(sub);
+}
+
+static void _event_queue_timer_cb(lv_timer_t *timer)
+{
+    EOS_UNUSED(timer);
+    eos_event_flush();
 }
 
 void eos_event_init(void)
@@ -59,6 +175,11 @@ void eos_event_init(void)
     {
         event_list[i] = lv_event_register_id();
     }
+    eos_mpsc_init(&event_thread_queue, event_thread_slots, EOS_EVENT_THREAD_QUEUE_SIZE);
+    thread_call_code = lv_event_register_id();
+    event_queue_timer = lv_timer_create(_event_queue_timer_cb, 0, NULL);
+    if (event_queue_timer)
+        lv_timer_pause(event_queue_timer);
 }
 
 uint32_t eos_event_get_code(eos_event_t e)
@@ -74,67 +195,178 @@ void eos_event_add_cb(lv_obj_t *obj, lv_event_cb_t cb, lv_event_code_t event, vo
         return;
     }
 
-    // 创建新节点
-    event_node_t *new_node = lv_malloc(sizeof(event_node_t));
-    if (!new_node)
+    int32_t bi = _event_bucket_get(event);
+    if (bi < 0)
     {
-        EOS_LOG_E("Failed to allocate event node");
+        EOS_LOG_E("Failed to allocate event bucket");
         return;
     }
+    event_bucket_t *b = &event_buckets[bi];
+    if (b->count == b->cap)
+    {
+        uint32_t cap = b->cap ? b->cap * 2 : EVENT_BUCKET_INIT_CAP;
+        event_sub_t **subs = lv_realloc(b->subs, cap * sizeof(event_sub_t *));
+        if (!subs)
+        {
+            EOS_LOG_E("Failed to allocate event node");
+            return;
+        }
+        b->subs = subs;
+        b->cap = cap;
+    }
 
-    new_node->obj = obj;
-    new_node->event = event;
-    new_node->cb = cb;
-    new_node->user_data = user_data;
-    new_node->next = NULL;
-
-    // 添加到链表头部
-    new_node->next = event_list_head;
-    event_list_head = new_node;
+    // 创建新订阅
+    event_sub_t *sub = lv_malloc(sizeof(event_sub_t));
+    if (!sub)
+    {
+        EOS_LOG_E("Failed to allocate event node");
+        return;
+    }
+    sub->obj = obj;
+    sub->cb = cb;
+    sub->user_data = user_data;
+    sub->bucket = (uint32_t)bi;
+    sub->index = b->count;
+    b->subs[b->count++] = sub;
 
     // 向LVGL注册事件回调
     lv_obj_add_event_cb(obj, cb, event, user_data);
 
-    // 确保有删除回调
-    lv_obj_add_event_cb(obj, _obj_delete_cb, LV_EVENT_DELETE, NULL);
+    // 对象删除时移除订阅
+    lv_obj_add_event_cb(obj, _obj_delete_cb, LV_EVENT_DELETE, sub);
 }
 
 void eos_event_remove_cb(lv_obj_t *obj, lv_event_code_t event, lv_event_cb_t cb)
 {
-    event_node_t **curr = &event_list_head;
-
-    while (*curr)
+    int32_t bi = _event_bucket_find(event);
+    if (bi < 0)
+        return;
+    event_bucket_t *b = &event_buckets[bi];
+    for (uint32_t i = 0; i < b->count; i++)
     {
-        if ((*curr)->obj == obj && (*curr)->event == event && (*curr)->cb == cb)
+        event_sub_t *sub = b->subs[i];
+        if (sub->obj == obj && sub->cb == cb)
         {
-            event_node_t *tmp = *curr;
-            *curr = (*curr)->next;
-
             // 从LVGL中移除回调
-            lv_obj_remove_event_cb(obj, cb);
-
-            lv_free(tmp);
+            lv_obj_remove_event_cb_with_user_data(obj, cb, sub->user_data);
+            lv_obj_remove_event_cb_with_user_data(obj, _obj_delete_cb, sub);
+            _event_sub_remove(sub);
             return;
         }
-        curr = &(*curr)->next;
     }
 }
 
 void eos_event_broadcast(lv_event_code_t event, void *param)
 {
-    event_node_t *curr = event_list_head;
+    int32_t bi = _event_bucket_find(event);
+    if (bi < 0)
+        return;
+    EOS_TRACE_SCOPE("event_broadcast");
+
+    // 回调中可能添加订阅导致数组重新分配，因此每次通过索引访问；
+    // 派发期间新增的订阅不会收到本次事件
+    event_buckets[bi].dispatching++;
+    uint32_t count = event_buckets[bi].count;
+    for (uint32_t i = 0; i < count; i++)
+    {
+        lv_obj_t *obj = event_buckets[bi].subs[i]->obj;
+        if (!obj)
+            continue;
+        // 使用lv_obj_send_event发送事件
+        lv_result_t res = lv_obj_send_event(obj, event, param);
+        if (res != LV_RESULT_OK)
+        {
+            EOS_LOG_W("Event %d send failed for obj %p", event, obj);
+        }
+    }
+    event_bucket_t *b = &event_buckets[bi];
+    if (--b->dispatching == 0 && b->has_removed)
+    {
+        _event_bucket_compact(b);
+    }
+}
+
+void eos_event_post(lv_event_code_t event, void *param)
+{
+    if (!event_queue_timer)
+    {
+        EOS_LOG_W("Event queue not initialized, broadcast directly");
+        eos_event_broadcast(event, param);
+        return;
+    }
+    // 合并重复的事件，保留最后一次投递的位置
+    for (uint32_t i = 0; i < event_queue_count; i++)
+    {
+        if (event_queue[i].event == event && event_queue[i].param == param)
+        {
+            lv_memmove(&event_queue[i], &event_queue[i + 1], (event_queue_count - i - 1) * sizeof(event_post_t));
+            event_queue_count--;
+            break;
+        }
+    }
+    if (event_queue_count >= EOS_EVENT_QUEUE_SIZE)
+    {
+        EOS_LOG_W("Event queue full, flush");
+        eos_event_flush();
+    }
+    event_queue[event_queue_count].event = event;
+    event_queue[event_queue_count].param = param;
+    event_queue_count++;
+    lv_timer_resume(event_queue_timer);
+    lv_timer_ready(event_queue_timer);
+}
+
+void eos_event_flush(void)
+{
+    if (event_queue_timer)
+        lv_timer_pause(event_queue_timer);
+    if (event_queue_count == 0)
+        return;
+    EOS_TRACE_SCOPE("event_flush");
+    // 派发期间投递的事件留到下一帧
+    event_post_t pending[EOS_EVENT_QUEUE_SIZE];
+    uint32_t count = event_queue_count;
+    lv_memcpy(pending, event_queue, count * sizeof(event_post_t));
+    event_queue_count = 0;
+    for (uint32_t i = 0; i < count; i++)
+    {
+        eos_event_broadcast(pending[i].event, pending[i].param);
+    }
+}
+
+eos_result_t eos_event_post_from_thread(lv_event_code_t event, const void *data, size_t size)
+{
+    if (size > EOS_MPSC_PAYLOAD_SIZE)
+        return -EOS_ERR_MEM;
+    // 此处不能调用 LVGL 与日志，队列满时由调用者决定重试或丢弃
+    if (!eos_mpsc_push(&event_thread_queue, (uint32_t)event, data, size))
+        return -EOS_ERR_BUSY;
+    eos_idle_wakeup();
+    return EOS_OK;
+}
+
+eos_result_t eos_event_call_from_thread(eos_thread_call_cb_t cb, void *user_data)
+{
+    if (!cb)
+        return -EOS_ERR_VAR_NULL;
+    thread_call_t call = {.cb = cb, .user_data = user_data};
+    return eos_event_post_from_thread((lv_event_code_t)thread_call_code, &call, sizeof(call));
+}
 
-    while (curr)
+void eos_event_dispatch_thread(void)
+{
+    eos_mpsc_msg_t msg;
+    for (uint32_t i = 0; i < EOS_EVENT_THREAD_QUEUE_SIZE; i++)
     {
-        if (curr->event == event && lv_obj_is_valid(curr->obj))
+        if (!eos_mpsc_pop(&event_thread_queue, &msg))
+            break;
+        if (thread_call_code && msg.code == thread_call_code)
         {
-            // 使用lv_obj_send_event发送事件
-            lv_result_t res = lv_obj_send_event(curr->obj, event, param);
-            if (res != LV_RESULT_OK)
-            {
-                EOS_LOG_W("Event %d send failed for obj %p", event, curr->obj);
-            }
+            thread_call_t call;
+            memcpy(&call, msg.data, sizeof(call));
+            call.cb(call.user_data);
+            continue;
         }
-        curr = curr->next;
+        eos_event_broadcast((lv_event_code_t)msg.code, &msg);
     }
 }
\ No newline at end of file
@@ -0,0 +1,224 @@
+/**
+ * @file elena_os_frame_stats.c
+ * @brief 帧耗时统计与 FPS / CPU 浮层
+ * @author Sab1e
+ * @date 2025-10-05
+ *
+ * 耗时记录在固定桶宽的直方图中，记录开销为常数且不分配内存，
+ * 分位数取所在桶的上界。
+ */
+
+#include "elena_os_frame_stats.h"
+
+// Includes
+#include <stdio.h>
+#include <stdlib.h>
+#include "lvgl.h"
+#include "elena_os_log.h"
+#include "elena_os_port.h"
+#include "elena_os_idle.h"
+#include "elena_os_config.h"
+// Macros and Definitions
+#ifndef EOS_FRAME_STATS_BUCKET_US
+#define EOS_FRAME_STATS_BUCKET_US 1000
+#endif /* EOS_FRAME_STATS_BUCKET_US */
+#define FRAME_STATS_BUCKET_COUNT 64         // 最后一个桶收集超出范围的耗时
+#define FRAME_STATS_WINDOW_US 1000000       // FPS / CPU 的统计窗口
+#define FRAME_STATS_OVERLAY_PERIOD 500      // 浮层刷新周期（ms）
+/**
+ * @brief 耗时直方图
+ */
+typedef struct
+{
+    uint32_t buckets[FRAME_STATS_BUCKET_COUNT];
+    uint32_t count;
+    uint32_t max;
+} frame_hist_t;
+// Variables
+static frame_hist_t hist_render;
+static frame_hist_t hist_handler;
+static frame_hist_t hist_idle;
+static uint32_t frames_total = 0;
+static uint64_t render_start_us = 0;
+// 统计窗口
+static uint64_t window_start_us = 0;
+static uint32_t window_frames = 0;
+static uint64_t window_busy_us = 0;
+static uint64_t window_idle_us = 0;
+static uint32_t last_fps = 0;
+static uint8_t last_cpu = 0;
+// 浮层
+static lv_obj_t *overlay_label = NULL;
+static lv_timer_t *overlay_timer = NULL;
+// Function Implementations
+static void _hist_add(frame_hist_t *h, uint32_t us)
+{
+    uint32_t idx = us / EOS_FRAME_STATS_BUCKET_US;
+    if (idx >= FRAME_STATS_BUCKET_COUNT)
+        idx = FRAME_STATS_BUCKET_COUNT - 1;
+    h->buckets[idx]++;
+    h->count++;
+    if (us > h->max)
+        h->max = us;
+}
+
+/**
+ * @brief 计算分位数
+ * @param pct 百分位（0~100）
+ */
+static uint32_t _hist_percentile(const frame_hist_t *h, uint32_t pct)
+{
+    if (h->count == 0)
+        return 0;
+    uint32_t target = (uint32_t)(((uint64_t)h->count * pct + 99) / 100);
+    uint32_t acc = 0;
+    for (uint32_t i = 0; i < FRAME_STATS_BUCKET_COUNT; i++)
+    {
+        acc += h->buckets[i];
+        if (acc >= target)
+        {
+            uint32_t upper = (i + 1) * EOS_FRAME_STATS_BUCKET_US;
+            // 超出范围的桶与最大值所在的桶使用真实的最大值
+            return (i == FRAME_STATS_BUCKET_COUNT - 1 || upper > h->max) ? h->max : upper;
+        }
+    }
+    return h->max;
+}
+
+static void _hist_dist(const frame_hist_t *h, eos_frame_stats_dist_t *dist)
+{
+    dist->p50 = _hist_percentile(h, 50);
+    dist->p95 = _hist_percentile(h, 95);
+    dist->p99 = _hist_percentile(h, 99);
+    dist->max = h->max;
+}
+
+/**
+ * @brief 统计窗口结束时计算 FPS 与 CPU 占用
+ */
+static void _window_update(uint64_t now)
+{
+    uint64_t elapsed = now - window_start_us;
+    if (elapsed < FRAME_STATS_WINDOW_US)
+        return;
+    last_fps = (uint32_t)(((uint64_t)window_frames * 1000000ULL + elapsed / 2) / elapsed);
+    uint64_t total = window_busy_us + window_idle_us;
+    last_cpu = total ? (uint8_t)(window_busy_us * 100 / total) : 0;
+    window_start_us = now;
+    window_frames = 0;
+    window_busy_us = 0;
+    window_idle_us = 0;
+}
+
+static void _render_event_cb(lv_event_t *e)
+{
+    if (lv_event_get_code(e) == LV_EVENT_RENDER_START)
+    {
+        render_start_us = eos_perf_time_get_us();
+        return;
+    }
+    if (render_start_us == 0)
+        return;
+    _hist_add(&hist_render, (uint32_t)(eos_perf_time_get_us() - render_start_us));
+    render_start_us = 0;
+    frames_total++;
+    window_frames++;
+}
+
+static void _overlay_timer_cb(lv_timer_t *timer)
+{
+    EOS_UNUSED(timer);
+    eos_frame_stats_t stats;
+    eos_frame_stats_get(&stats);
+    lv_label_set_text_fmt(overlay_label,
+                          "%" LV_PRIu32 " FPS  CPU %d%%  WAKE %" LV_PRIu32 "\n"
+                          "R %" LV_PRIu32 "/%" LV_PRIu32 "/%" LV_PRIu32 " ms",
+                          stats.fps, stats.cpu, eos_idle_wakeups_per_sec(),
+                          stats.render.p50 / 1000, stats.render.p95 / 1000, stats.render.p99 / 1000);
+}
+
+static void _overlay_delete_cb(lv_event_t *e)
+{
+    EOS_UNUSED(e);
+    overlay_label = NULL;
+    if (overlay_timer)
+    {
+        lv_timer_delete(overlay_timer);
+        overlay_timer = NULL;
+    }
+}
+
+void eos_frame_stats_init(void)
+{
+    lv_display_t *disp = lv_display_get_default();
+    if (!disp)
+    {
+        EOS_LOG_W("Display not found, render time not recorded");
+    }
+    else
+    {
+        lv_display_add_event_cb(disp, _render_event_cb, LV_EVENT_RENDER_START, NULL);
+        lv_display_add_event_cb(disp, _render_event_cb, LV_EVENT_RENDER_READY, NULL);
+    }
+    window_start_us = eos_time_get_us();
+#ifdef EOS_FRAME_STATS_OVERLAY
+    eos_frame_stats_overlay_set(true);
+#endif /* EOS_FRAME_STATS_OVERLAY */
+}
+
+void eos_frame_stats_loop_record(uint32_t handler_us, uint32_t idle_us)
+{
+    _hist_add(&hist_handler, handler_us);
+    _hist_add(&hist_idle, idle_us);
+    window_busy_us += handler_us;
+    window_idle_us += idle_us;
+    _window_update(eos_time_get_us());
+}
+
+void eos_frame_stats_get(eos_frame_stats_t *stats)
+{
+    EOS_CHECK_PTR_RETURN(stats);
+    _window_update(eos_time_get_us());
+    stats->fps = last_fps;
+    stats->cpu = last_cpu;
+    stats->frames = frames_total;
+    _hist_dist(&hist_render, &stats->render);
+    _hist_dist(&hist_handler, &stats->handler);
+    _hist_dist(&hist_idle, &stats->idle);
+}
+
+void eos_frame_stats_reset(void)
+{
+    lv_memzero(&hist_render, sizeof(frame_hist_t));
+    lv_memzero(&hist_handler, sizeof(frame_hist_t));
+    lv_memzero(&hist_idle, sizeof(frame_hist_t));
+    frames_total = 0;
+}
+
+void eos_frame_stats_overlay_set(bool show)
+{
+    if (!show)
+    {
+        if (overlay_label)
+            lv_obj_delete(overlay_label); // 删除回调中释放定时器
+        return;
+    }
+    if (overlay_label)
+        return;
+    overlay_label = lv_label_create(lv_layer_top());
+    lv_obj_remove_flag(overlay_label, LV_OBJ_FLAG_CLICKABLE);
+    lv_obj_set_style_bg_color(overlay_label, lv_color_black(), 0);
+    lv_obj_set_style_bg_opa(overlay_label, LV_OPA_60, 0);
+    lv_obj_set_style_text_color(overlay_label, lv_color_white(), 0);
+    lv_obj_set_style_pad_all(overlay_label, 4, 0);
+    lv_obj_set_style_radius(overlay_label, 6, 0);
+    lv_obj_align(overlay_label, LV_ALIGN_TOP_MID, 0, 8);
+    lv_label_set_text(overlay_label, "-- FPS");
+    lv_obj_add_event_cb(overlay_label, _overlay_delete_cb, LV_EVENT_DELETE, NULL);
+    overlay_timer = lv_timer_create(_overlay_timer_cb, FRAME_STATS_OVERLAY_PERIOD, NULL);
+}
+
+bool eos_frame_stats_overlay_is_shown(void)
+{
+    return overlay_label != NULL;
+}
@@ -0,0 +1,115 @@
+/**
+ * @file elena_os_idle.c
+ * @brief 主循环空闲管理（休眠到下一个定时器到期，输入与驱动事件可提前唤醒）
+ * @author Sab1e
+ * @date 2025-10-08
+ *
+ * 开启 EOS_IDLE_INPUT_WAKEUP 时，无操作一段时间后暂停输入设备的轮询定时器，
+ * 由输入驱动调用 eos_idle_wakeup 唤醒后恢复轮询。
+ */
+
+#include "elena_os_idle.h"
+
+// Includes
+#include <stdio.h>
+#include <stdlib.h>
+#include "lvgl.h"
+#include "elena_os_log.h"
+#include "elena_os_port.h"
+#include "elena_os_config.h"
+// Macros and Definitions
+#ifndef EOS_IDLE_MAX_SLEEP_MS
+#define EOS_IDLE_MAX_SLEEP_MS 5000
+#endif /* EOS_IDLE_MAX_SLEEP_MS */
+#ifndef EOS_IDLE_INPUT_POLL_MS
+#define EOS_IDLE_INPUT_POLL_MS 500
+#endif /* EOS_IDLE_INPUT_POLL_MS */
+#define IDLE_WINDOW_US 1000000 // 唤醒次数的统计窗口
+// Variables
+static uint64_t window_start_us = 0;
+static uint32_t window_wakeups = 0;
+static uint32_t last_wakeups = 0;
+#ifdef EOS_IDLE_INPUT_WAKEUP
+static bool input_paused = false;
+#endif /* EOS_IDLE_INPUT_WAKEUP */
+// Function Implementations
+#ifdef EOS_IDLE_INPUT_WAKEUP
+/**
+ * @brief 暂停或恢复所有输入设备的轮询定时器
+ */
+static void _input_poll_set(bool enable)
+{
+    lv_indev_t *indev = lv_indev_get_next(NULL);
+    while (indev)
+    {
+        lv_timer_t *timer = lv_indev_get_read_timer(indev);
+        if (timer)
+        {
+            if (enable)
+            {
+                lv_timer_resume(timer);
+                lv_timer_ready(timer);
+            }
+            else
+            {
+                lv_timer_pause(timer);
+            }
+        }
+        indev = lv_indev_get_next(indev);
+    }
+    input_paused = !enable;
+}
+#endif /* EOS_IDLE_INPUT_WAKEUP */
+
+static void _wakeup_count(void)
+{
+    uint64_t now = eos_time_get_us();
+    window_wakeups++;
+    if (now - window_start_us >= IDLE_WINDOW_US)
+    {
+        last_wakeups = window_wakeups;
+        window_wakeups = 0;
+        window_start_us = now;
+    }
+}
+
+void eos_idle_sleep(uint32_t next_ms)
+{
+    // 有定时器已就绪，直接进入下一次循环
+    if (next_ms == 0)
+        return;
+    // 没有定时器时 next_ms 为 LV_NO_TIMER_READY
+    uint32_t ms = next_ms < EOS_IDLE_MAX_SLEEP_MS ? next_ms : EOS_IDLE_MAX_SLEEP_MS;
+#ifdef EOS_IDLE_INPUT_WAKEUP
+    if (!input_paused && lv_display_get_inactive_time(NULL) >= EOS_IDLE_INPUT_POLL_MS)
+    {
+        // 本次的 next_ms 仍包含轮询定时器，下一次循环起按其他定时器计算
+        _input_poll_set(false);
+    }
+#endif /* EOS_IDLE_INPUT_WAKEUP */
+    bool woken = eos_idle_wait(ms);
+    _wakeup_count();
+#ifdef EOS_IDLE_INPUT_WAKEUP
+    if (woken && input_paused)
+    {
+        _input_poll_set(true);
+    }
+#else
+    EOS_UNUSED(woken);
+#endif /* EOS_IDLE_INPUT_WAKEUP */
+}
+
+void eos_idle_input_resume(void)
+{
+#ifdef EOS_IDLE_INPUT_WAKEUP
+    if (input_paused)
+    {
+        _input_poll_set(true);
+    }
+#endif /* EOS_IDLE_INPUT_WAKEUP */
+}
+
+uint32_t eos_idle_wakeups_per_sec(void)
+{
+    return last_wakeups;
+}
@@ -14,48 +14,1029 @@
 #include <unistd.h>
 #include <sys/stat.h>
 #include <string.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <limits.h>
 #include "lvgl.h"
 #include "elena_os_log.h"
 #include "elena_os_port.h"
+#include "elena_os_config.h"
+#include "elena_os_trace.h"
+#include "elena_os_event.h"
+#include "elena_os_img_conv.h"
+#include "elena_os_nav.h"
 // Macros and Definitions
 #define LV_IMG_BIN_HEADER_SIZE 12 // Bytes
 #define LV_IMG_BIN_HEADER_WIDTH_LB 4
 #define LV_IMG_BIN_HEADER_HEIGHT_LB 6
 #define LV_IMG_BIN_HEADER_STRIDE_LB 8
-// Variables
+#ifndef EOS_IMG_CACHE_RETAIN_COUNT
+#define EOS_IMG_CACHE_RETAIN_COUNT 8
+#endif /* EOS_IMG_CACHE_RETAIN_COUNT */
+#ifndef EOS_IMG_MEM_BUDGET
+#define EOS_IMG_MEM_BUDGET (2 * 1024 * 1024)
+#endif /* EOS_IMG_MEM_BUDGET */
+#ifndef EOS_IMG_ASYNC_STACK_SIZE
+#define EOS_IMG_ASYNC_STACK_SIZE 16384
+#endif /* EOS_IMG_ASYNC_STACK_SIZE */
+#define EOS_IMG_ASYNC_NOTIFY_RETRY 1000 // 通知 UI 线程失败（队列满）时的重试次数，每次间隔 1ms
+#define EOS_IMG_COMPRESSED_HEADER_SIZE 12 // LVGL 压缩图片头大小
+#if LVGL_VERSION_MAJOR > 9 || (LVGL_VERSION_MAJOR == 9 && LVGL_VERSION_MINOR >= 2)
+#define EOS_IMG_CONV_LV_9_2 // 支持 RGB565_SWAPPED 与 ARGB8888_PREMULTIPLIED
+#endif
+
+/**
+ * @brief 图片缓存条目
+ *
+ * 同一路径（且文件未修改）的图片只加载一次，由所有引用它的 Image 对象共享
+ */
+typedef struct _img_cache_entry_t
+{
+    char *path;                         // 图片路径
+    time_t mtime;                       // 文件修改时间
+    off_t file_size;                    // 文件大小
+    void *bin_data;                     // bin 文件数据（可能已转换格式）
+    bool mapped;                        // bin_data 为文件映射（零拷贝）
+    size_t mem_size;                    // 计入预算的堆内存大小（映射为 0）
+    lv_image_dsc_t img_dsc;             // 图片描述符
+    uint32_t ref_cnt;                   // 引用计数
+    uint32_t last_used;                 // 最近一次释放的时间戳，用于 LRU 淘汰
+    bool stale;                         // 文件已变化，已从缓存中移除
+    struct _img_cache_entry_t *next;
+} img_cache_entry_t;
 
+/**
+ * @brief Image 对象与缓存条目的绑定
+ *
+ * 超出内存预算时，不在当前屏幕上的对象会释放图片（entry 为 NULL，记录 path），
+ * 所在屏幕再次加载时重新加载并恢复原来的尺寸
+ */
+typedef struct _img_binding_t
+{
+    lv_obj_t *obj;
+    img_cache_entry_t *entry;           // 当前图片，被淘汰时为 NULL
+    char *path;                         // 被淘汰的图片路径
+    uint32_t nav_seq;                   // 绑定时的导航提交次数
+    int32_t orig_w;                     // 被淘汰前的本地宽高样式
+    int32_t orig_h;
+    bool orig_w_local;                  // 被淘汰前是否设置了本地宽高
+    bool orig_h_local;
+    struct _img_binding_t *prev;
+    struct _img_binding_t *next;
+} img_binding_t;
+// Variables
+static img_cache_entry_t *img_cache_head = NULL; // 图片缓存链表头
+static uint32_t img_cache_retained = 0;          // 未被引用但仍保留的条目数量
+static uint32_t img_cache_tick = 0;
+static size_t img_mem_used = 0;                  // 图片占用的堆内存
+static img_binding_t *img_binding_head = NULL;   // 所有绑定
+static lv_obj_t *img_loading_scr = NULL;         // 正在加载（即将显示）的屏幕
+static bool img_budget_enforcing = false;
+static bool img_low_memory_pending = false;
 // Function Implementations
+
+static void _img_cache_unlink(img_cache_entry_t *entry)
+{
+    img_cache_entry_t **curr = &img_cache_head;
+    while (*curr)
+    {
+        if (*curr == entry)
+        {
+            *curr = entry->next;
+            entry->next = NULL;
+            return;
+        }
+        curr = &(*curr)->next;
+    }
+}
+
+static void _img_data_free(void *bin_data, bool mapped, off_t file_size)
+{
+    if (!bin_data)
+        return;
+    if (mapped)
+        eos_file_munmap(bin_data, file_size);
+    else
+        eos_free_large(bin_data);
+}
+
+static void _img_cache_entry_free(img_cache_entry_t *entry)
+{
+    lv_image_cache_drop(&entry->img_dsc);
+    img_mem_used -= entry->mem_size;
+    _img_data_free(entry->bin_data, entry->mapped, entry->file_size);
+    lv_free(entry->path);
+    lv_free(entry);
+}
+
+/**
+ * @brief 淘汰最久未使用的未引用条目
+ * @return true 已淘汰一个条目
+ */
+static bool _img_cache_evict_lru(void)
+{
+    img_cache_entry_t *victim = NULL;
+    for (img_cache_entry_t *e = img_cache_head; e; e = e->next)
+    {
+        if (e->ref_cnt == 0 && (!victim || e->last_used < victim->last_used))
+            victim = e;
+    }
+    if (!victim)
+        return false;
+    _img_cache_unlink(victim);
+    img_cache_retained--;
+    EOS_LOG_D("Image cache evict: %s", victim->path);
+    _img_cache_entry_free(victim);
+    return true;
+}
+
+/**
+ * @brief 保留的未引用条目超过上限时，淘汰最久未使用的条目
+ */
+static void _img_cache_trim(uint32_t retain)
+{
+    while (img_cache_retained > retain && _img_cache_evict_lru())
+        ;
+}
+
+static void _img_cache_release(img_cache_entry_t *entry)
+{
+    if (!entry || entry->ref_cnt == 0)
+        return;
+    if (--entry->ref_cnt > 0)
+        return;
+    if (entry->stale)
+    {
+        _img_cache_entry_free(entry);
+        return;
+    }
+    entry->last_used = ++img_cache_tick;
+    img_cache_retained++;
+    _img_cache_trim(EOS_IMG_CACHE_RETAIN_COUNT);
+}
+
+/**
+ * @brief 读取整个文件到 eos_malloc_large 分配的内存
+ */
+static void *_img_file_read(const char *bin_path, off_t file_size)
+{
+    int fd = open(bin_path, O_RDONLY);
+    if (fd == -1)
+    {
+        EOS_LOG_E("Failed to open file: %s\n", bin_path);
+        return NULL;
+    }
+
+    // 分配内存
+    void *bin_data = eos_malloc_large(file_size);
+    if (!bin_data)
+    {
+        EOS_LOG_E("Failed to allocate memory for image\n");
+        close(fd);
+        return NULL;
+    }
+
+    // 读取文件内容到内存
+    ssize_t bytes_read = read(fd, bin_data, file_size);
+    close(fd); // 读取完成后立即关闭文件描述符
+
+    if (bytes_read != file_size)
+    {
+        EOS_LOG_E("Failed to read complete file (read %zd of %ld bytes)\n", bytes_read, (long)file_size);
+        eos_free_large(bin_data);
+        return NULL;
+    }
+    return bin_data;
+}
+
+/**
+ * @brief 校验 bin 文件头，压缩图片额外校验压缩头与解码支持
+ * @note 压缩图片（eos_pkg_builder.py --compress）的数据区以压缩头开始，由 LVGL 的 bin 解码器
+ * 解压到图片缓存中，需要在 lv_conf.h 中启用 LV_USE_RLE 和/或 LV_USE_LZ4_INTERNAL，
+ * 并为 LV_CACHE_DEF_SIZE 预留至少一张解码后图片的空间
+ */
+static bool _img_data_validate(const void *bin_data, off_t file_size)
+{
+    const lv_image_header_t *header = (const lv_image_header_t *)bin_data;
+    if (header->magic != LV_IMAGE_HEADER_MAGIC)
+    {
+        EOS_LOG_E("Invalid image magic\n");
+        return false;
+    }
+    if (!(header->flags & LV_IMAGE_FLAGS_COMPRESSED))
+        return true;
+
+    off_t data_size = file_size - sizeof(lv_image_header_t);
+    if (data_size < EOS_IMG_COMPRESSED_HEADER_SIZE)
+    {
+        EOS_LOG_E("Invalid compressed image\n");
+        return false;
+    }
+    // 压缩头：method(4) + compressed_size(4) + decompressed_size(4)
+    uint32_t compressed_header[3];
+    memcpy(compressed_header, (const uint8_t *)bin_data + sizeof(lv_image_header_t), sizeof(compressed_header));
+    if (compressed_header[1] != (uint32_t)(data_size - EOS_IMG_COMPRESSED_HEADER_SIZE))
+    {
+        EOS_LOG_E("Compressed size mismatch\n");
+        return false;
+    }
+    switch (compressed_header[0])
+    {
+#if LV_USE_RLE
+    case LV_IMAGE_COMPRESS_RLE:
+        return true;
+#endif /* LV_USE_RLE */
+#if LV_USE_LZ4
+    case LV_IMAGE_COMPRESS_LZ4:
+        return true;
+#endif /* LV_USE_LZ4 */
+    default:
+        EOS_LOG_E("Unsupported image compression: %u\n", (unsigned)compressed_header[0]);
+        return false;
+    }
+}
+
+#ifdef EOS_IMG_CONVERT
+/**
+ * @brief 将图片转换为显示器的原生格式，避免每帧绘制时重复转换与混合
+ * @return void* 转换后的数据（映射的文件或格式变化时为新分配的内存），无需转换或失败时返回原数据
+ * @note 不调用任何 LVGL 接口，可在加载线程中使用
+ */
+static void *_img_data_convert(void *bin_data, off_t file_size, bool *mapped, size_t *data_size)
+{
+    lv_image_header_t header;
+    memcpy(&header, bin_data, sizeof(header));
+    if (header.flags & LV_IMAGE_FLAGS_COMPRESSED)
+        return bin_data;
+    uint32_t w = header.w;
+    uint32_t h = header.h;
+    uint32_t stride = header.stride;
+    if ((off_t)stride * h > file_size - (off_t)sizeof(header))
+        return bin_data;
+    const uint8_t *src = (const uint8_t *)bin_data + sizeof(header);
+
+    size_t out_size;
+#if LV_COLOR_DEPTH == 16
+    if (header.cf == LV_COLOR_FORMAT_ARGB8888 && stride >= w * 4)
+    {
+        // 颜色平面与 Alpha 平面，Alpha 平面步长为 stride / 2
+        out_size = sizeof(header) + (size_t)w * 3 * h;
+        header.cf = LV_COLOR_FORMAT_RGB565A8;
+        header.stride = w * 2;
+    }
+#ifdef EOS_IMG_CONV_LV_9_2
+    else if (header.cf == LV_COLOR_FORMAT_RGB565_SWAPPED && stride >= w * 2)
+    {
+        out_size = (size_t)file_size;
+        header.cf = LV_COLOR_FORMAT_RGB565;
+    }
+#endif /* EOS_IMG_CONV_LV_9_2 */
+    else
+        return bin_data;
+#elif LV_COLOR_DEPTH == 32 && defined(EOS_IMG_CONV_LV_9_2)
+    if (header.cf == LV_COLOR_FORMAT_ARGB8888 && stride >= w * 4)
+    {
+        out_size = (size_t)file_size;
+        header.cf = LV_COLOR_FORMAT_ARGB8888_PREMULTIPLIED;
+        header.flags |= LV_IMAGE_FLAGS_PREMULTIPLIED;
+    }
+    else
+        return bin_data;
+#else
+    EOS_UNUSED(mapped);
+    EOS_UNUSED(data_size);
+    EOS_UNUSED(src);
+    return bin_data;
+#endif /* LV_COLOR_DEPTH */
+
+#if LV_COLOR_DEPTH == 16 || (LV_COLOR_DEPTH == 32 && defined(EOS_IMG_CONV_LV_9_2))
+    // 映射的文件只读，大小变化时也需要新内存
+    bool in_place = !*mapped && out_size == (size_t)file_size;
+    uint8_t *out = in_place ? (uint8_t *)bin_data : (uint8_t *)eos_malloc_large(out_size);
+    if (!out)
+    {
+        EOS_LOG_W("No memory to convert image, using stored format\n");
+        return bin_data;
+    }
+    uint8_t *dst = out + sizeof(header);
+    for (uint32_t y = 0; y < h; y++)
+    {
+        const uint8_t *src_row = src + (size_t)y * stride;
+        switch (header.cf)
+        {
+#if LV_COLOR_DEPTH == 16
+        case LV_COLOR_FORMAT_RGB565A8:
+            eos_img_conv_argb8888_to_rgb565a8(src_row, (uint16_t *)(dst + (size_t)y * w * 2),
+                                              dst + (size_t)w * 2 * h + (size_t)y * w, w);
+            break;
+#ifdef EOS_IMG_CONV_LV_9_2
+        case LV_COLOR_FORMAT_RGB565:
+            eos_img_conv_rgb565_swap((const uint16_t *)src_row, (uint16_t *)(dst + (size_t)y * stride), w);
+            break;
+#endif /* EOS_IMG_CONV_LV_9_2 */
+#else
+        case LV_COLOR_FORMAT_ARGB8888_PREMULTIPLIED:
+            eos_img_conv_argb8888_premultiply(src_row, dst + (size_t)y * stride, w);
+            break;
+#endif /* LV_COLOR_DEPTH == 16 */
+        default:
+            break;
+        }
+    }
+    memcpy(out, &header, sizeof(header));
+    if (!in_place)
+    {
+        _img_data_free(bin_data, *mapped, file_size);
+        *mapped = false;
+    }
+    *data_size = out_size;
+    return out;
+#endif
+}
+#endif /* EOS_IMG_CONVERT */
+
+/**
+ * @brief 加载并校验图片文件数据
+ * @param data_size 输出数据大小（格式转换后可能与文件大小不同）
+ * @note 不调用任何 LVGL 接口，可在加载线程中使用
+ */
+static void *_img_data_load(const char *bin_path, off_t file_size, bool *mapped, size_t *data_size)
+{
+    EOS_TRACE_SCOPE("img_data_load");
+    *mapped = false;
+    *data_size = (size_t)file_size;
+    if (file_size <= (off_t)sizeof(lv_image_header_t))
+    {
+        EOS_LOG_E("Invalid file size\n");
+        return NULL;
+    }
+
+    void *bin_data = NULL;
+#ifdef EOS_IMG_USE_MMAP
+    // 优先直接映射文件，像素数据无需拷贝到堆中
+    size_t map_size = 0;
+    bin_data = (void *)eos_file_mmap(bin_path, &map_size);
+    if (bin_data && map_size == (size_t)file_size)
+    {
+        *mapped = true;
+    }
+    else if (bin_data)
+    {
+        eos_file_munmap(bin_data, map_size);
+        bin_data = NULL;
+    }
+#endif /* EOS_IMG_USE_MMAP */
+    if (!bin_data)
+    {
+        bin_data = _img_file_read(bin_path, file_size);
+        if (!bin_data)
+            return NULL;
+    }
+
+    if (!_img_data_validate(bin_data, file_size))
+    {
+        _img_data_free(bin_data, *mapped, file_size);
+        return NULL;
+    }
+#ifdef EOS_IMG_CONVERT
+    bin_data = _img_data_convert(bin_data, file_size, mapped, data_size);
+#endif /* EOS_IMG_CONVERT */
+    return bin_data;
+}
+
+/**
+ * @brief 在缓存中查找未修改的图片，命中时引用计数 +1
+ */
+static img_cache_entry_t *_img_cache_lookup(const char *bin_path, time_t mtime, off_t file_size)
+{
+    for (img_cache_entry_t *e = img_cache_head; e; e = e->next)
+    {
+        if (strcmp(e->path, bin_path) != 0)
+            continue;
+        if (e->mtime == mtime && e->file_size == file_size)
+        {
+            if (e->ref_cnt++ == 0)
+                img_cache_retained--;
+            return e;
+        }
+        // 文件已被修改，旧条目不再参与查找
+        _img_cache_unlink(e);
+        if (e->ref_cnt == 0)
+        {
+            img_cache_retained--;
+            _img_cache_entry_free(e);
+        }
+        else
+        {
+            e->stale = true;
+        }
+        return NULL;
+    }
+    return NULL;
+}
+
+/************************** 内存预算 **************************/
+
+static void _img_low_memory_async_cb(void *user_data)
+{
+    EOS_UNUSED(user_data);
+    img_low_memory_pending = false;
+    eos_event_broadcast(eos_event_get_code(EOS_EVENT_LOW_MEMORY), NULL);
+}
+
+/**
+ * @brief 判断绑定的对象是否不在显示中
+ * @note 导航栈顶页面与正在加载的页面视为显示中；上次导航提交之后才绑定的对象
+ * 可能属于正在构建的页面，同样不淘汰
+ */
+static bool _img_binding_offscreen(const img_binding_t *binding)
+{
+    if (binding->nav_seq == eos_nav_commit_seq())
+        return false;
+    lv_obj_t *scr = lv_obj_get_screen(binding->obj);
+    lv_display_t *disp = lv_obj_get_display(binding->obj);
+    if (scr == lv_display_get_screen_active(disp) ||
+        scr == lv_display_get_screen_prev(disp) ||
+        scr == img_loading_scr ||
+        scr == eos_nav_top())
+        return false;
+#if LVGL_VERSION_MAJOR > 9 || (LVGL_VERSION_MAJOR == 9 && LVGL_VERSION_MINOR >= 2)
+    if (scr == lv_display_get_screen_loading(disp))
+        return false;
+#endif
+    // 图层始终显示
+    return scr != lv_display_get_layer_top(disp) &&
+           scr != lv_display_get_layer_sys(disp) &&
+           scr != lv_display_get_layer_bottom(disp);
+}
+
+/**
+ * @brief 恢复对象被淘汰前的宽高样式
+ */
+static void _img_binding_size_restore(img_binding_t *binding)
+{
+    if (binding->orig_w_local)
+        lv_obj_set_width(binding->obj, binding->orig_w);
+    else
+        lv_obj_remove_local_style_prop(binding->obj, LV_STYLE_WIDTH, 0);
+    if (binding->orig_h_local)
+        lv_obj_set_height(binding->obj, binding->orig_h);
+    else
+        lv_obj_remove_local_style_prop(binding->obj, LV_STYLE_HEIGHT, 0);
+}
+
+/**
+ * @brief 释放屏幕外对象的图片，所在屏幕加载时再重新加载
+ */
+static void _img_binding_evict(img_binding_t *binding)
+{
+    img_cache_entry_t *entry = binding->entry;
+    binding->path = lv_strdup(entry->path);
+    if (!binding->path)
+        return;
+    // 记录原来的宽高样式后固定对象尺寸，释放图片后布局保持不变
+    lv_style_value_t v;
+    binding->orig_w_local = lv_obj_get_local_style_prop(binding->obj, LV_STYLE_WIDTH, &v, 0) == LV_STYLE_RES_FOUND;
+    binding->orig_w = binding->orig_w_local ? v.num : 0;
+    binding->orig_h_local = lv_obj_get_local_style_prop(binding->obj, LV_STYLE_HEIGHT, &v, 0) == LV_STYLE_RES_FOUND;
+    binding->orig_h = binding->orig_h_local ? v.num : 0;
+    lv_obj_update_layout(binding->obj);
+    lv_obj_set_size(binding->obj, lv_obj_get_width(binding->obj), lv_obj_get_height(binding->obj));
+    lv_image_set_src(binding->obj, NULL);
+    binding->entry = NULL;
+    _img_cache_release(entry);
+}
+
+/**
+ * @brief 图片占用超出预算时依次淘汰：未引用的缓存 -> 屏幕外对象的图片 -> 通知低内存
+ */
+static void _img_budget_enforce(void)
+{
+    if (img_mem_used <= EOS_IMG_MEM_BUDGET || img_budget_enforcing)
+        return;
+    img_budget_enforcing = true;
+
+    while (img_mem_used > EOS_IMG_MEM_BUDGET && _img_cache_evict_lru())
+        ;
+    for (img_binding_t *b = img_binding_head; b && img_mem_used > EOS_IMG_MEM_BUDGET; b = b->next)
+    {
+        if (!b->entry || b->entry->mem_size == 0 || !_img_binding_offscreen(b))
+            continue;
+        _img_binding_evict(b);
+        while (img_mem_used > EOS_IMG_MEM_BUDGET && _img_cache_evict_lru())
+            ;
+    }
+
+    if (img_mem_used > EOS_IMG_MEM_BUDGET && !img_low_memory_pending)
+    {
+        EOS_LOG_W("Image memory over budget: %zu / %zu", img_mem_used, (size_t)EOS_IMG_MEM_BUDGET);
+        // 延迟广播，避免回调在加载过程中删除对象
+        img_low_memory_pending = true;
+        lv_async_call(_img_low_memory_async_cb, NULL);
+    }
+    img_budget_enforcing = false;
+}
+
+/**
+ * @brief 将加载好的图片数据加入缓存（引用计数为 1），失败时释放数据
+ */
+static img_cache_entry_t *_img_cache_insert(const char *bin_path, time_t mtime, off_t file_size,
+                                            void *bin_data, bool mapped, size_t data_size)
+{
+    img_cache_entry_t *entry = (img_cache_entry_t *)lv_malloc_zeroed(sizeof(img_cache_entry_t));
+    if (!entry)
+    {
+        EOS_LOG_E("Failed to allocate image cache entry\n");
+        _img_data_free(bin_data, mapped, file_size);
+        return NULL;
+    }
+    entry->bin_data = bin_data;
+    entry->mapped = mapped;
+    entry->file_size = file_size;
+    entry->path = lv_strdup(bin_path);
+    if (!entry->path)
+    {
+        _img_cache_entry_free(entry);
+        return NULL;
+    }
+    memcpy(&entry->img_dsc.header, bin_data, sizeof(lv_image_header_t));
+    entry->mtime = mtime;
+    entry->img_dsc.data_size = data_size - sizeof(lv_image_header_t);
+    entry->img_dsc.data = (const uint8_t *)bin_data + sizeof(lv_image_header_t);
+    entry->mem_size = mapped ? 0 : data_size;
+    img_mem_used += entry->mem_size;
+    entry->ref_cnt = 1;
+    entry->next = img_cache_head;
+    img_cache_head = entry;
+    _img_budget_enforce();
+    return entry;
+}
+
+/**
+ * @brief 获取路径对应的缓存条目（引用计数 +1），不存在时从文件加载
+ */
+static img_cache_entry_t *_img_cache_acquire(const char *bin_path)
+{
+    struct stat file_stat;
+    if (stat(bin_path, &file_stat) == -1)
+    {
+        EOS_LOG_E("Failed to stat file: %s\n", bin_path);
+        return NULL;
+    }
+
+    img_cache_entry_t *entry = _img_cache_lookup(bin_path, file_stat.st_mtime, file_stat.st_size);
+    if (entry)
+        return entry;
+
+    bool mapped = false;
+    size_t data_size = 0;
+    void *bin_data = _img_data_load(bin_path, file_stat.st_size, &mapped, &data_size);
+    if (!bin_data)
+        return NULL;
+    return _img_cache_insert(bin_path, file_stat.st_mtime, file_stat.st_size, bin_data, mapped, data_size);
+}
+
+static void _img_binding_free(img_binding_t *binding)
+{
+    if (binding->prev)
+        binding->prev->next = binding->next;
+    else
+        img_binding_head = binding->next;
+    if (binding->next)
+        binding->next->prev = binding->prev;
+    if (binding->entry)
+        _img_cache_release(binding->entry);
+    lv_free(binding->path);
+    lv_free(binding);
+}
+
 /**
  * @brief 删除事件回调函数
  */
 static void _img_delete_event_cb(lv_event_t *e)
 {
     EOS_LOG_D("Try delete image");
-    lv_obj_t *img_obj = lv_event_get_target(e);
-    EOS_CHECK_PTR_RETURN(img_obj);
+    img_binding_t *binding = (img_binding_t *)lv_event_get_user_data(e);
+    EOS_CHECK_PTR_RETURN(binding);
+    _img_binding_free(binding);
+    EOS_LOG_D("Image released.");
+}
+
+/**
+ * @brief 屏幕加载时重新加载被淘汰的图片
+ */
+static void _img_screen_load_cb(lv_event_t *e)
+{
+    lv_obj_t *scr = lv_event_get_current_target(e);
+    img_loading_scr = scr;
+    for (img_binding_t *b = img_binding_head; b; b = b->next)
+    {
+        if (b->entry || !b->path || lv_obj_get_screen(b->obj) != scr)
+            continue;
+        img_cache_entry_t *entry = _img_cache_acquire(b->path);
+        if (!entry)
+            continue;
+        b->entry = entry;
+        _img_binding_size_restore(b);
+        lv_image_set_src(b->obj, &entry->img_dsc);
+        lv_free(b->path);
+        b->path = NULL;
+    }
+    img_loading_scr = NULL;
+}
+
+/**
+ * @brief 查找对象上指定回调的事件描述符
+ * @return int32_t 事件索引，未找到返回 -1
+ */
+static int32_t _img_event_find(lv_obj_t *img_obj, lv_event_cb_t cb, void **user_data)
+{
+    uint32_t event_cnt = lv_obj_get_event_count(img_obj);
+    for (uint32_t i = 0; i < event_cnt; i++)
+    {
+        lv_event_dsc_t *dsc = lv_obj_get_event_dsc(img_obj, i);
+        if (lv_event_dsc_get_cb(dsc) == cb)
+        {
+            *user_data = lv_event_dsc_get_user_data(dsc);
+            return (int32_t)i;
+        }
+    }
+    return -1;
+}
+
+/**
+ * @brief 为 Image 对象设置缓存条目（接管一次引用），对象删除时释放
+ */
+static void _img_bind(lv_obj_t *img_obj, img_cache_entry_t *entry)
+{
+    img_binding_t *binding = (img_binding_t *)lv_malloc_zeroed(sizeof(img_binding_t));
+    if (!binding)
+    {
+        EOS_LOG_E("Failed to allocate image binding");
+        _img_cache_release(entry);
+        return;
+    }
+    binding->obj = img_obj;
+    binding->entry = entry;
+    binding->nav_seq = eos_nav_commit_seq();
+    binding->next = img_binding_head;
+    if (img_binding_head)
+        img_binding_head->prev = binding;
+    img_binding_head = binding;
+
+    lv_image_set_src(img_obj, &entry->img_dsc);
+    lv_obj_add_event_cb(img_obj, _img_delete_event_cb, LV_EVENT_DELETE, binding);
+
+    // 每个屏幕只注册一次加载回调
+    lv_obj_t *scr = lv_obj_get_screen(img_obj);
+    void *user_data = NULL;
+    if (scr && _img_event_find(scr, _img_screen_load_cb, &user_data) < 0)
+    {
+        lv_obj_add_event_cb(scr, _img_screen_load_cb, LV_EVENT_SCREEN_LOAD_START, NULL);
+    }
+}
+
+/************************** 异步加载 **************************/
+
+/**
+ * @brief 等待图片的 Image 对象
+ */
+typedef struct _img_async_waiter_t
+{
+    lv_obj_t *obj;
+    uint32_t w; // 加载期间记录的目标尺寸（0 表示未设置）
+    uint32_t h;
+    struct _img_async_job_t *job;
+    struct _img_async_waiter_t *next;
+} img_async_waiter_t;
+
+/**
+ * @brief 加载任务，同一路径的并发请求合并为一个任务
+ */
+typedef struct _img_async_job_t
+{
+    char *path;
+    img_async_waiter_t *waiters;          // 仅在 LVGL 线程访问
+    bool cancelled;                       // 所有等待者都已取消（受锁保护）
+    /* 以下由加载线程写入 */
+    void *bin_data;
+    bool mapped;
+    off_t file_size;
+    size_t data_size;
+    time_t mtime;
+    struct _img_async_job_t *next;        // 请求 / 完成队列链接（受锁保护）
+    struct _img_async_job_t *inflight_next; // 未完成任务链表，仅在 LVGL 线程访问
+} img_async_job_t;
+
+typedef struct
+{
+    pthread_t thread;
+    pthread_mutex_t lock;
+    pthread_cond_t cond;
+    pthread_cond_t idle_cond;      // 请求队列为空且没有正在加载的任务
+    bool busy;                     // 加载线程正在处理任务（受锁保护）
+    img_async_job_t *pending_head; // 请求队列
+    img_async_job_t *pending_tail;
+    img_async_job_t *done_head;    // 完成队列
+    img_async_job_t *done_tail;
+    img_async_job_t *inflight;     // 已提交但结果尚未处理的任务
+    lv_timer_t *timer;             // 在 LVGL 线程中处理完成队列，有结果时由加载线程通知就绪
+    atomic_bool notify_pending;    // 已通知 UI 线程但完成队列尚未处理
+    bool initialized;
+} img_async_t;
+
+static img_async_t img_async = {0};
+
+static void _img_async_queue_push(img_async_job_t **head, img_async_job_t **tail, img_async_job_t *job)
+{
+    job->next = NULL;
+    if (*tail)
+        (*tail)->next = job;
+    else
+        *head = job;
+    *tail = job;
+}
+
+static void _img_async_done_cb(void *user_data)
+{
+    EOS_UNUSED(user_data);
+    lv_timer_resume(img_async.timer);
+    lv_timer_ready(img_async.timer);
+}
+
+/**
+ * @brief 通知 UI 线程处理完成队列（同时唤醒空闲中的主循环），已通知未处理时不重复通知
+ */
+static void _img_async_notify(void)
+{
+    if (atomic_exchange(&img_async.notify_pending, true))
+        return;
+    for (uint32_t i = 0; i < EOS_IMG_ASYNC_NOTIFY_RETRY; i++)
+    {
+        if (eos_event_call_from_thread(_img_async_done_cb, NULL) != -EOS_ERR_BUSY)
+            return;
+        usleep(1000);
+    }
+    // 放弃本次通知，下一个完成的任务会再次通知
+    atomic_store(&img_async.notify_pending, false);
+    EOS_LOG_W("Image loader notify failed, event queue full");
+}
 
-    // 从事件中获取用户数据
-    img_user_data_t *user_data = (img_user_data_t *)lv_event_get_user_data(e);
-    EOS_CHECK_PTR_RETURN(user_data);
+static void *_img_async_worker(void *arg)
+{
+    EOS_UNUSED(arg);
+    while (1)
+    {
+        pthread_mutex_lock(&img_async.lock);
+        while (!img_async.pending_head)
+        {
+            pthread_cond_wait(&img_async.cond, &img_async.lock);
+        }
+        img_async_job_t *job = img_async.pending_head;
+        img_async.pending_head = job->next;
+        if (!img_async.pending_head)
+            img_async.pending_tail = NULL;
+        bool cancelled = job->cancelled;
+        img_async.busy = true;
+        pthread_mutex_unlock(&img_async.lock);
+
+        if (!cancelled)
+        {
+            struct stat file_stat;
+            if (stat(job->path, &file_stat) == 0)
+            {
+                job->file_size = file_stat.st_size;
+                job->mtime = file_stat.st_mtime;
+                job->bin_data = _img_data_load(job->path, file_stat.st_size, &job->mapped, &job->data_size);
+            }
+            else
+            {
+                EOS_LOG_E("Failed to stat file: %s\n", job->path);
+            }
+        }
+
+        pthread_mutex_lock(&img_async.lock);
+        _img_async_queue_push(&img_async.done_head, &img_async.done_tail, job);
+        pthread_mutex_unlock(&img_async.lock);
+        _img_async_notify();
+
+        pthread_mutex_lock(&img_async.lock);
+        img_async.busy = false;
+        if (!img_async.pending_head)
+            pthread_cond_broadcast(&img_async.idle_cond);
+        pthread_mutex_unlock(&img_async.lock);
+    }
+    return NULL;
+}
+
+/**
+ * @brief 取消一个等待者，任务没有等待者时标记为取消
+ */
+static void _img_async_waiter_cancel(img_async_waiter_t *waiter)
+{
+    img_async_job_t *job = waiter->job;
+    img_async_waiter_t **curr = &job->waiters;
+    while (*curr)
+    {
+        if (*curr == waiter)
+        {
+            *curr = waiter->next;
+            break;
+        }
+        curr = &(*curr)->next;
+    }
+    if (!job->waiters)
+    {
+        pthread_mutex_lock(&img_async.lock);
+        job->cancelled = true;
+        pthread_mutex_unlock(&img_async.lock);
+    }
+    lv_free(waiter);
+}
+
+static void _img_async_delete_cb(lv_event_t *e)
+{
+    img_async_waiter_t *waiter = (img_async_waiter_t *)lv_event_get_user_data(e);
+    EOS_CHECK_PTR_RETURN(waiter);
+    _img_async_waiter_cancel(waiter);
+}
+
+static void _img_async_job_finish(img_async_job_t *job)
+{
+    img_cache_entry_t *entry = NULL;
+    if (job->bin_data)
+    {
+        // 加载期间可能已有同步请求缓存了同一文件
+        entry = _img_cache_lookup(job->path, job->mtime, job->file_size);
+        if (entry)
+            _img_data_free(job->bin_data, job->mapped, job->file_size);
+        else
+            entry = _img_cache_insert(job->path, job->mtime, job->file_size, job->bin_data, job->mapped,
+                                      job->data_size);
+        job->bin_data = NULL;
+    }
+
+    img_async_waiter_t *waiter = job->waiters;
+    while (waiter)
+    {
+        img_async_waiter_t *next = waiter->next;
+        lv_obj_remove_event_cb_with_user_data(waiter->obj, _img_async_delete_cb, waiter);
+        if (entry)
+        {
+            entry->ref_cnt++;
+            _img_bind(waiter->obj, entry);
+            if (waiter->w && waiter->h)
+                eos_img_set_size(waiter->obj, waiter->w, waiter->h);
+        }
+        else
+        {
+            lv_image_set_src(waiter->obj, NULL);
+        }
+        lv_free(waiter);
+        waiter = next;
+    }
+    job->waiters = NULL;
+    // 释放任务持有的引用，无人使用时按 LRU 保留
+    if (entry)
+        _img_cache_release(entry);
+}
+
+static void _img_async_timer_cb(lv_timer_t *timer)
+{
+    // 先清除通知标记再取队列，之后完成的任务会重新通知
+    lv_timer_pause(timer);
+    atomic_store(&img_async.notify_pending, false);
+    pthread_mutex_lock(&img_async.lock);
+    img_async_job_t *job = img_async.done_head;
+    img_async.done_head = NULL;
+    img_async.done_tail = NULL;
+    pthread_mutex_unlock(&img_async.lock);
+
+    while (job)
+    {
+        img_async_job_t *next = job->next;
+        img_async_job_t **curr = &img_async.inflight;
+        while (*curr && *curr != job)
+            curr = &(*curr)->inflight_next;
+        if (*curr)
+            *curr = job->inflight_next;
+        _img_async_job_finish(job);
+        lv_free(job->path);
+        lv_free(job);
+        job = next;
+    }
+}
+
+static bool _img_async_init(void)
+{
+    if (img_async.initialized)
+        return true;
+    if (pthread_mutex_init(&img_async.lock, NULL) != 0 ||
+        pthread_cond_init(&img_async.cond, NULL) != 0 ||
+        pthread_cond_init(&img_async.idle_cond, NULL) != 0)
+    {
+        EOS_LOG_E("Image loader init failed");
+        return false;
+    }
+    pthread_attr_t attr;
+    pthread_attr_init(&attr);
+    // 小于 PTHREAD_STACK_MIN 时设置会失败并退回默认栈大小
+    size_t stack_size = EOS_IMG_ASYNC_STACK_SIZE;
+#ifdef PTHREAD_STACK_MIN
+    if (stack_size < (size_t)PTHREAD_STACK_MIN)
+        stack_size = PTHREAD_STACK_MIN;
+#endif /* PTHREAD_STACK_MIN */
+    int err = pthread_attr_setstacksize(&attr, stack_size);
+    if (err != 0)
+        EOS_LOG_W("Set image loader stack size %zu failed: %d", stack_size, err);
+    pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_DETACHED);
+    int ret = pthread_create(&img_async.thread, &attr, _img_async_worker, NULL);
+    pthread_attr_destroy(&attr);
+    if (ret != 0)
+    {
+        EOS_LOG_E("Create image loader thread failed: %d", ret);
+        pthread_cond_destroy(&img_async.cond);
+        pthread_cond_destroy(&img_async.idle_cond);
+        pthread_mutex_destroy(&img_async.lock);
+        return false;
+    }
+    img_async.timer = lv_timer_create(_img_async_timer_cb, 0, NULL);
+    lv_timer_pause(img_async.timer);
+    img_async.initialized = true;
+    return true;
+}
 
-    if (user_data->bin_data)
+/**
+ * @brief 解除 Image 对象当前持有的缓存条目或未完成的异步请求
+ */
+static void _img_detach(lv_obj_t *img_obj)
+{
+    void *user_data = NULL;
+    int32_t index = _img_event_find(img_obj, _img_async_delete_cb, &user_data);
+    if (index >= 0)
     {
-        eos_free_large(user_data->bin_data);
-        user_data->bin_data = NULL;
+        lv_obj_remove_event(img_obj, index);
+        _img_async_waiter_cancel((img_async_waiter_t *)user_data);
+        lv_image_set_src(img_obj, NULL);
     }
-    if (user_data->img_dsc)
+    index = _img_event_find(img_obj, _img_delete_event_cb, &user_data);
+    if (index >= 0)
     {
-        lv_free(user_data->img_dsc);
-        user_data->img_dsc = NULL;
+        lv_obj_remove_event(img_obj, index);
+        img_binding_t *binding = (img_binding_t *)user_data;
+        if (!binding->entry && binding->path)
+            _img_binding_size_restore(binding);
+        // 先解除引用再释放，避免绘制已释放的数据
+        lv_image_set_src(img_obj, NULL);
+        _img_binding_free(binding);
     }
-    lv_free(user_data);
-    EOS_LOG_D("Image deleted.");
+}
+
+/**
+ * @brief 查找图片指定尺寸的预缩放变体
+ * @return true 变体存在，路径写入 buf
+ */
+static bool _img_variant_find(const char *src_path, uint32_t w, uint32_t h, char *buf, size_t size)
+{
+    eos_img_variant_path(buf, size, src_path, w, h);
+    struct stat file_stat;
+    return stat(buf, &file_stat) == 0;
+}
+
+void eos_img_set_src_sized(lv_obj_t *img_obj, const char *bin_path, const uint32_t w, const uint32_t h)
+{
+    EOS_CHECK_PTR_RETURN(img_obj && bin_path);
+    char variant_path[PATH_MAX];
+    if (_img_variant_find(bin_path, w, h, variant_path, sizeof(variant_path)))
+        bin_path = variant_path;
+    eos_img_set_src(img_obj, bin_path);
+    eos_img_set_size(img_obj, w, h);
+}
+
+void eos_img_set_src_sized_async(lv_obj_t *img_obj, const char *bin_path, const uint32_t w, const uint32_t h)
+{
+    EOS_CHECK_PTR_RETURN(img_obj && bin_path);
+    char variant_path[PATH_MAX];
+    if (_img_variant_find(bin_path, w, h, variant_path, sizeof(variant_path)))
+        bin_path = variant_path;
+    eos_img_set_src_async(img_obj, bin_path);
+    eos_img_set_size(img_obj, w, h);
 }
 
 void eos_img_set_size(lv_obj_t *img_obj, const uint32_t w, const uint32_t h)
 {
-    const void *src = lv_img_get_src(img_obj);
+    void *user_data = NULL;
+    if (_img_event_find(img_obj, _img_async_delete_cb, &user_data) >= 0)
+    {
+        // 异步加载中：记录目标尺寸，加载完成后再缩放
+        img_async_waiter_t *waiter = (img_async_waiter_t *)user_data;
+        waiter->w = w;
+        waiter->h = h;
+        lv_obj_set_size(img_obj, w, h);
+        return;
+    }
 
+    const void *src = lv_img_get_src(img_obj);
     if (src == NULL)
     {
         EOS_LOG_E("Image src is NULL");
@@ -85,96 +1066,266 @@ void eos_img_set_src(lv_obj_t *img_obj, const char *bin_path)
 {
     EOS_CHECK_PTR_RETURN(img_obj);
 
-    // 清除回调
-    lv_obj_remove_event_cb_with_user_data(img_obj, _img_delete_event_cb, NULL);
+    // 先获取新图片，相同路径时直接复用缓存条目
+    img_cache_entry_t *entry = bin_path ? _img_cache_acquire(bin_path) : NULL;
 
-    // 避免数据泄漏
-    lv_image_set_src(img_obj, NULL);
-
-    // 打开新图像文件
-    int fd = open(bin_path, O_RDONLY);
-    if (fd == -1)
-    {
-        EOS_LOG_E("Failed to open file: %s\n", bin_path);
+    // 释放之前的图片引用，避免数据泄漏
+    _img_detach(img_obj);
+    if (!entry)
         return;
-    }
 
-    // 获取文件大小
+    // 设置图像源，对象删除时释放引用
+    _img_bind(img_obj, entry);
+    EOS_LOG_D("Image Set OK");
+}
+
+void eos_img_set_src_async(lv_obj_t *img_obj, const char *bin_path)
+{
+    EOS_CHECK_PTR_RETURN(img_obj);
+    EOS_CHECK_PTR_RETURN(bin_path);
+
+    // 已缓存的图片直接使用，无需等待
     struct stat file_stat;
-    if (fstat(fd, &file_stat) == -1)
+    if (stat(bin_path, &file_stat) == 0)
     {
-        EOS_LOG_E("Failed to get file size\n");
-        close(fd);
-        return;
+        img_cache_entry_t *entry = _img_cache_lookup(bin_path, file_stat.st_mtime, file_stat.st_size);
+        if (entry)
+        {
+            _img_detach(img_obj);
+            _img_bind(img_obj, entry);
+            return;
+        }
     }
-    off_t file_size = file_stat.st_size;
 
-    if (file_size <= 0)
+    if (!_img_async_init())
     {
-        EOS_LOG_E("Invalid file size\n");
-        close(fd);
+        eos_img_set_src(img_obj, bin_path);
         return;
     }
 
-    // 分配内存
-    void *bin_data = eos_malloc_large(file_size);
-    if (!bin_data)
+    img_async_waiter_t *waiter = (img_async_waiter_t *)lv_malloc_zeroed(sizeof(img_async_waiter_t));
+    EOS_CHECK_PTR_RETURN(waiter);
+
+    // 先解除旧的绑定：若对象正在等待同一路径，取消后的任务不会被复用
+    _img_detach(img_obj);
+
+    // 同一路径已有未完成的任务时直接等待该任务
+    img_async_job_t *job = img_async.inflight;
+    while (job && (job->cancelled || strcmp(job->path, bin_path) != 0))
+        job = job->inflight_next;
+    if (!job)
     {
-        EOS_LOG_E("Failed to allocate memory for image\n");
-        close(fd);
-        return;
+        job = (img_async_job_t *)lv_malloc_zeroed(sizeof(img_async_job_t));
+        if (job)
+            job->path = lv_strdup(bin_path);
+        if (!job || !job->path)
+        {
+            EOS_LOG_E("Failed to allocate image load job");
+            lv_free(job);
+            lv_free(waiter);
+            return;
+        }
+        job->inflight_next = img_async.inflight;
+        img_async.inflight = job;
+        pthread_mutex_lock(&img_async.lock);
+        _img_async_queue_push(&img_async.pending_head, &img_async.pending_tail, job);
+        pthread_cond_signal(&img_async.cond);
+        pthread_mutex_unlock(&img_async.lock);
     }
 
-    // 读取文件内容到内存
-    ssize_t bytes_read = read(fd, bin_data, file_size);
-    close(fd); // 读取完成后立即关闭文件描述符
+    waiter->obj = img_obj;
+    waiter->job = job;
+    waiter->next = job->waiters;
+    job->waiters = waiter;
 
-    if (bytes_read != file_size)
+    // 显示占位符
+    lv_image_set_src(img_obj, LV_SYMBOL_IMAGE);
+    lv_obj_add_event_cb(img_obj, _img_async_delete_cb, LV_EVENT_DELETE, waiter);
+}
+
+bool eos_img_async_flush(void)
+{
+    if (!img_async.initialized || !img_async.inflight)
+        return false;
+    pthread_mutex_lock(&img_async.lock);
+    while (img_async.pending_head || img_async.busy)
     {
-        EOS_LOG_E("Failed to read complete file (read %zd of %ld bytes)\n", bytes_read, file_size);
-        eos_free_large(bin_data);
-        return;
+        pthread_cond_wait(&img_async.idle_cond, &img_async.lock);
     }
+    pthread_mutex_unlock(&img_async.lock);
+    _img_async_timer_cb(img_async.timer);
+    return true;
+}
+
+lv_draw_buf_t *eos_img_snapshot_take(lv_obj_t *obj, lv_color_format_t cf)
+{
+    EOS_CHECK_PTR_RETURN_VAL(obj, NULL);
 
-    // 动态分配图像描述符
-    lv_image_dsc_t *img_dsc = (lv_image_dsc_t *)lv_malloc(sizeof(lv_image_dsc_t));
-    if (!img_dsc)
+    lv_obj_update_layout(obj);
+    int32_t w = lv_obj_get_width(obj);
+    int32_t h = lv_obj_get_height(obj);
+    if (w <= 0 || h <= 0)
     {
-        EOS_LOG_E("Failed to allocate image descriptor\n");
-        eos_free_large(bin_data);
-        return;
+        EOS_LOG_E("Invalid snapshot size: %dx%d", (int)w, (int)h);
+        return NULL;
     }
-    memset(img_dsc, 0, sizeof(lv_image_dsc_t));
-
-    memcpy(&img_dsc->header, bin_data, sizeof(lv_image_header_t));
 
-    if (img_dsc->header.magic != LV_IMAGE_HEADER_MAGIC)
+    uint32_t stride = lv_draw_buf_width_to_stride(w, cf);
+    uint32_t data_size = stride * h + LV_DRAW_BUF_ALIGN - 1; // 预留对齐空间
+    void *data = eos_malloc_large(data_size);
+    if (!data)
     {
-        EOS_LOG_E("Invalid image magic\n");
-        lv_free(img_dsc);
-        eos_free_large(bin_data);
-        return;
+        EOS_LOG_E("Failed to allocate snapshot buffer (%u bytes)", (unsigned)data_size);
+        return NULL;
     }
+    lv_draw_buf_t *draw_buf = (lv_draw_buf_t *)lv_malloc_zeroed(sizeof(lv_draw_buf_t));
+    if (!draw_buf)
+    {
+        eos_free_large(data);
+        return NULL;
+    }
+    // lv_draw_buf_init 会对齐 data 并记录原始指针到 unaligned_data
+    if (lv_draw_buf_init(draw_buf, w, h, cf, stride, data, data_size) != LV_RESULT_OK ||
+        lv_snapshot_take_to_draw_buf(obj, cf, draw_buf) != LV_RESULT_OK)
+    {
+        EOS_LOG_E("Snapshot failed");
+        eos_free_large(data);
+        lv_free(draw_buf);
+        return NULL;
+    }
+    return draw_buf;
+}
+
+void eos_img_snapshot_free(lv_draw_buf_t *draw_buf)
+{
+    EOS_CHECK_PTR_RETURN(draw_buf);
+    lv_image_cache_drop(draw_buf);
+    eos_free_large(draw_buf->unaligned_data);
+    lv_free(draw_buf);
+}
+
+eos_result_t eos_img_draw_buf_save(const lv_draw_buf_t *draw_buf, const char *path)
+{
+    EOS_CHECK_PTR_RETURN_VAL(draw_buf && path, -EOS_ERR_VAR_NULL);
 
-    // 直接赋值图像描述符头
-    img_dsc->data_size = file_size - sizeof(lv_image_header_t);
-    img_dsc->data = (const uint8_t *)bin_data + sizeof(lv_image_header_t);
+    lv_image_header_t header = draw_buf->header;
+    header.magic = LV_IMAGE_HEADER_MAGIC;
+    header.flags = 0;
+    size_t data_size = (size_t)header.stride * header.h;
 
-    // 创建用户数据结构
-    img_user_data_t *user_data = (img_user_data_t *)lv_malloc(sizeof(img_user_data_t));
-    if (!user_data)
+    // 先写临时文件再替换，避免已映射的旧文件被原地改写
+    char tmp_path[PATH_MAX];
+    snprintf(tmp_path, sizeof(tmp_path), "%s.tmp", path);
+    FILE *fp = fopen(tmp_path, "wb");
+    if (!fp)
     {
-        EOS_LOG_E("Failed to allocate user data\n");
-        eos_free_large(bin_data);
-        lv_free(img_dsc);
-        return;
+        EOS_LOG_E("Failed to open file: %s", tmp_path);
+        return -EOS_ERR_FILE_ERROR;
     }
-    user_data->bin_data = bin_data;
-    user_data->img_dsc = img_dsc;
+    bool ok = fwrite(&header, 1, sizeof(header), fp) == sizeof(header) &&
+              fwrite(draw_buf->data, 1, data_size, fp) == data_size;
+    fclose(fp);
+    if (!ok || rename(tmp_path, path) != 0)
+    {
+        EOS_LOG_E("Failed to write image: %s", path);
+        remove(tmp_path);
+        return -EOS_ERR_FILE_ERROR;
+    }
+    return EOS_OK;
+}
 
-    // 设置图像源
-    lv_image_set_src(img_obj, img_dsc);
-    // 添加删除事件回调，并将用户数据附加到回调
-    lv_obj_add_event_cb(img_obj, _img_delete_event_cb, LV_EVENT_DELETE, user_data);
-    EOS_LOG_D("Image Set OK");
+/**
+ * @brief 借助 LVGL 的变换绘制将图像源一次性缩放并保存
+ */
+static eos_result_t _img_scale_src_to_file(const void *src, lv_color_format_t cf, const char *dst_path,
+                                           uint32_t w, uint32_t h)
+{
+    lv_obj_t *img = lv_image_create(lv_layer_top());
+    lv_obj_remove_style_all(img);
+    lv_image_set_src(img, src);
+    lv_image_set_inner_align(img, LV_IMAGE_ALIGN_STRETCH);
+    lv_obj_set_size(img, w, h);
+    lv_draw_buf_t *draw_buf = eos_img_snapshot_take(img, cf);
+    lv_obj_delete(img);
+    if (!draw_buf)
+        return -EOS_FAILED;
+
+    eos_result_t ret = eos_img_draw_buf_save(draw_buf, dst_path);
+    eos_img_snapshot_free(draw_buf);
+    return ret;
+}
+
+eos_result_t eos_img_scale_to_file(const char *src_path, const char *dst_path, uint32_t w, uint32_t h)
+{
+    EOS_CHECK_PTR_RETURN_VAL(src_path && dst_path, -EOS_ERR_VAR_NULL);
+    if (w == 0 || h == 0)
+        return -EOS_FAILED;
+
+    img_cache_entry_t *entry = _img_cache_acquire(src_path);
+    if (!entry)
+        return -EOS_FAILED;
+    lv_color_format_t cf = lv_color_format_has_alpha(entry->img_dsc.header.cf)
+                               ? LV_COLOR_FORMAT_ARGB8888
+                               : LV_COLOR_FORMAT_NATIVE;
+    eos_result_t ret = _img_scale_src_to_file(&entry->img_dsc, cf, dst_path, w, h);
+    _img_cache_release(entry);
+    EOS_LOG_D("Scaled %s -> %s (%ux%u)", src_path, dst_path, (unsigned)w, (unsigned)h);
+    return ret;
+}
+
+eos_result_t eos_img_obj_scale_to_file(lv_obj_t *obj, const char *dst_path, uint32_t w, uint32_t h)
+{
+    EOS_CHECK_PTR_RETURN_VAL(obj && dst_path, -EOS_ERR_VAR_NULL);
+    if (w == 0 || h == 0)
+        return -EOS_FAILED;
+
+    lv_draw_buf_t *full = eos_img_snapshot_take(obj, LV_COLOR_FORMAT_NATIVE);
+    if (!full)
+        return -EOS_FAILED;
+    eos_result_t ret = _img_scale_src_to_file(full, LV_COLOR_FORMAT_NATIVE, dst_path, w, h);
+    eos_img_snapshot_free(full);
+    return ret;
+}
+
+void eos_img_variant_path(char *buf, size_t size, const char *src_path, uint32_t w, uint32_t h)
+{
+    size_t len = strlen(src_path);
+    const char *ext = ".bin";
+    if (len >= 4 && strcmp(src_path + len - 4, ext) == 0)
+        len -= 4;
+    snprintf(buf, size, "%.*s_%ux%u%s", (int)len, src_path, (unsigned)w, (unsigned)h, ext);
+}
+
+eos_result_t eos_img_variant_generate(const char *src_path, uint32_t w, uint32_t h)
+{
+    EOS_CHECK_PTR_RETURN_VAL(src_path, -EOS_ERR_VAR_NULL);
+
+    struct stat src_stat;
+    if (stat(src_path, &src_stat) != 0)
+        return -EOS_FAILED;
+
+    char variant_path[PATH_MAX];
+    eos_img_variant_path(variant_path, sizeof(variant_path), src_path, w, h);
+    struct stat dst_stat;
+    if (stat(variant_path, &dst_stat) == 0 && dst_stat.st_mtime >= src_stat.st_mtime)
+        return EOS_OK;
+
+    // 源图片已是目标尺寸时无需生成
+    lv_image_header_t header;
+    int fd = open(src_path, O_RDONLY);
+    if (fd == -1)
+        return -EOS_FAILED;
+    ssize_t bytes_read = read(fd, &header, sizeof(header));
+    close(fd);
+    if (bytes_read != sizeof(header) || header.magic != LV_IMAGE_HEADER_MAGIC)
+        return -EOS_FAILED;
+    if (header.w == w && header.h == h)
+        return EOS_OK;
+
+    return eos_img_scale_to_file(src_path, variant_path, w, h);
+}
+
+size_t eos_img_mem_used(void)
+{
+    return img_mem_used;
 }
\ No newline at end of file
@@ -0,0 +1,297 @@
+/**
+ * @file elena_os_img_conv.c
+ * @brief 图片像素格式转换（SSE2 / NEON / 标量）
+ * @author Sab1e
+ * @date 2025-09-28
+ */
+
+#include "elena_os_img_conv.h"
+
+// Includes
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <inttypes.h>
+#include "lvgl.h"
+#include "elena_os_log.h"
+#include "elena_os_port.h"
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define EOS_IMG_CONV_SSE2
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define EOS_IMG_CONV_NEON
+#include <arm_neon.h>
+#endif
+// Macros and Definitions
+#if defined(EOS_IMG_CONV_SSE2) || defined(EOS_IMG_CONV_NEON)
+#define EOS_IMG_CONV_SIMD
+#endif
+
+/**
+ * @brief 精确的 x / 255 四舍五入（x <= 255 * 255）
+ */
+#define DIV255(x) (((x) + 128 + (((x) + 128) >> 8)) >> 8)
+// Variables
+static bool conv_simd_enabled = true;
+// Function Implementations
+
+/************************** 标量实现 **************************/
+
+static void _rgb565_swap_scalar(const uint16_t *src, uint16_t *dst, uint32_t count)
+{
+    for (uint32_t i = 0; i < count; i++)
+    {
+        uint16_t v = src[i];
+        dst[i] = (uint16_t)((v << 8) | (v >> 8));
+    }
+}
+
+static void _premultiply_scalar(const uint8_t *src, uint8_t *dst, uint32_t count)
+{
+    for (uint32_t i = 0; i < count; i++, src += 4, dst += 4)
+    {
+        uint32_t a = src[3];
+        dst[0] = (uint8_t)DIV255(src[0] * a);
+        dst[1] = (uint8_t)DIV255(src[1] * a);
+        dst[2] = (uint8_t)DIV255(src[2] * a);
+        dst[3] = (uint8_t)a;
+    }
+}
+
+static void _to_rgb565a8_scalar(const uint8_t *src, uint16_t *dst_rgb, uint8_t *dst_a, uint32_t count)
+{
+    for (uint32_t i = 0; i < count; i++, src += 4)
+    {
+        dst_rgb[i] = (uint16_t)(((src[2] & 0xF8) << 8) | ((src[1] & 0xFC) << 3) | (src[0] >> 3));
+        dst_a[i] = src[3];
+    }
+}
+
+/************************** SIMD 实现 **************************/
+
+#if defined(EOS_IMG_CONV_SSE2)
+
+static uint32_t _rgb565_swap_simd(const uint16_t *src, uint16_t *dst, uint32_t count)
+{
+    uint32_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        __m128i v = _mm_loadu_si128((const __m128i *)(src + i));
+        v = _mm_or_si128(_mm_slli_epi16(v, 8), _mm_srli_epi16(v, 8));
+        _mm_storeu_si128((__m128i *)(dst + i), v);
+    }
+    return i;
+}
+
+/**
+ * @brief 两个像素（8 个 16 位通道）预乘，Alpha 通道乘以 255 保持不变
+ */
+static inline __m128i _premultiply_u16(__m128i px)
+{
+    const __m128i alpha_keep = _mm_set_epi16(0xFF, 0, 0, 0, 0xFF, 0, 0, 0);
+    __m128i a = _mm_shufflelo_epi16(px, _MM_SHUFFLE(3, 3, 3, 3));
+    a = _mm_shufflehi_epi16(a, _MM_SHUFFLE(3, 3, 3, 3));
+    a = _mm_or_si128(a, alpha_keep);
+    __m128i t = _mm_add_epi16(_mm_mullo_epi16(px, a), _mm_set1_epi16(128));
+    return _mm_srli_epi16(_mm_add_epi16(t, _mm_srli_epi16(t, 8)), 8);
+}
+
+static uint32_t _premultiply_simd(const uint8_t *src, uint8_t *dst, uint32_t count)
+{
+    const __m128i zero = _mm_setzero_si128();
+    uint32_t i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        __m128i v = _mm_loadu_si128((const __m128i *)(src + i * 4));
+        __m128i lo = _premultiply_u16(_mm_unpacklo_epi8(v, zero));
+        __m128i hi = _premultiply_u16(_mm_unpackhi_epi8(v, zero));
+        _mm_storeu_si128((__m128i *)(dst + i * 4), _mm_packus_epi16(lo, hi));
+    }
+    return i;
+}
+
+/**
+ * @brief 四个像素转换为 RGB565（结果为符号扩展的 32 位通道，便于 packs 打包）
+ */
+static inline __m128i _to_rgb565_u32(__m128i px)
+{
+    __m128i r = _mm_and_si128(_mm_srli_epi32(px, 8), _mm_set1_epi32(0xF800));
+    __m128i g = _mm_and_si128(_mm_srli_epi32(px, 5), _mm_set1_epi32(0x07E0));
+    __m128i b = _mm_and_si128(_mm_srli_epi32(px, 3), _mm_set1_epi32(0x001F));
+    __m128i c = _mm_or_si128(_mm_or_si128(r, g), b);
+    return _mm_srai_epi32(_mm_slli_epi32(c, 16), 16);
+}
+
+static uint32_t _to_rgb565a8_simd(const uint8_t *src, uint16_t *dst_rgb, uint8_t *dst_a, uint32_t count)
+{
+    uint32_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        __m128i v0 = _mm_loadu_si128((const __m128i *)(src + i * 4));
+        __m128i v1 = _mm_loadu_si128((const __m128i *)(src + i * 4 + 16));
+        __m128i rgb = _mm_packs_epi32(_to_rgb565_u32(v0), _to_rgb565_u32(v1));
+        _mm_storeu_si128((__m128i *)(dst_rgb + i), rgb);
+        __m128i a = _mm_packs_epi32(_mm_srli_epi32(v0, 24), _mm_srli_epi32(v1, 24));
+        _mm_storel_epi64((__m128i *)(dst_a + i), _mm_packus_epi16(a, a));
+    }
+    return i;
+}
+
+#elif defined(EOS_IMG_CONV_NEON)
+
+static uint32_t _rgb565_swap_simd(const uint16_t *src, uint16_t *dst, uint32_t count)
+{
+    uint32_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        uint8x16_t v = vld1q_u8((const uint8_t *)(src + i));
+        vst1q_u8((uint8_t *)(dst + i), vrev16q_u8(v));
+    }
+    return i;
+}
+
+static inline uint8x8_t _div255_u16(uint16x8_t x)
+{
+    uint16x8_t t = vaddq_u16(x, vdupq_n_u16(128));
+    return vshrn_n_u16(vaddq_u16(t, vshrq_n_u16(t, 8)), 8);
+}
+
+static uint32_t _premultiply_simd(const uint8_t *src, uint8_t *dst, uint32_t count)
+{
+    uint32_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        uint8x8x4_t px = vld4_u8(src + i * 4);
+        px.val[0] = _div255_u16(vmull_u8(px.val[0], px.val[3]));
+        px.val[1] = _div255_u16(vmull_u8(px.val[1], px.val[3]));
+        px.val[2] = _div255_u16(vmull_u8(px.val[2], px.val[3]));
+        vst4_u8(dst + i * 4, px);
+    }
+    return i;
+}
+
+static uint32_t _to_rgb565a8_simd(const uint8_t *src, uint16_t *dst_rgb, uint8_t *dst_a, uint32_t count)
+{
+    uint32_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        uint8x8x4_t px = vld4_u8(src + i * 4);
+        uint16x8_t r = vshll_n_u8(vand_u8(px.val[2], vdup_n_u8(0xF8)), 8);
+        uint16x8_t g = vshll_n_u8(vand_u8(px.val[1], vdup_n_u8(0xFC)), 3);
+        uint16x8_t b = vmovl_u8(vshr_n_u8(px.val[0], 3));
+        vst1q_u16(dst_rgb + i, vorrq_u16(vorrq_u16(r, g), b));
+        vst1_u8(dst_a + i, px.val[3]);
+    }
+    return i;
+}
+
+#endif /* EOS_IMG_CONV_SSE2 / EOS_IMG_CONV_NEON */
+
+/************************** 对外接口 **************************/
+
+const char *eos_img_conv_backend(void)
+{
+#if defined(EOS_IMG_CONV_SSE2)
+    return conv_simd_enabled ? "SSE2" : "scalar";
+#elif defined(EOS_IMG_CONV_NEON)
+    return conv_simd_enabled ? "NEON" : "scalar";
+#else
+    return "scalar";
+#endif
+}
+
+void eos_img_conv_set_simd(bool enable)
+{
+    conv_simd_enabled = enable;
+}
+
+void eos_img_conv_rgb565_swap(const uint16_t *src, uint16_t *dst, uint32_t count)
+{
+    uint32_t i = 0;
+#ifdef EOS_IMG_CONV_SIMD
+    if (conv_simd_enabled)
+        i = _rgb565_swap_simd(src, dst, count);
+#endif /* EOS_IMG_CONV_SIMD */
+    _rgb565_swap_scalar(src + i, dst + i, count - i);
+}
+
+void eos_img_conv_argb8888_premultiply(const uint8_t *src, uint8_t *dst, uint32_t count)
+{
+    uint32_t i = 0;
+#ifdef EOS_IMG_CONV_SIMD
+    if (conv_simd_enabled)
+        i = _premultiply_simd(src, dst, count);
+#endif /* EOS_IMG_CONV_SIMD */
+    _premultiply_scalar(src + i * 4, dst + i * 4, count - i);
+}
+
+void eos_img_conv_argb8888_to_rgb565a8(const uint8_t *src, uint16_t *dst_rgb, uint8_t *dst_a, uint32_t count)
+{
+    uint32_t i = 0;
+#ifdef EOS_IMG_CONV_SIMD
+    if (conv_simd_enabled)
+        i = _to_rgb565a8_simd(src, dst_rgb, dst_a, count);
+#endif /* EOS_IMG_CONV_SIMD */
+    _to_rgb565a8_scalar(src + i * 4, dst_rgb + i, dst_a + i, count - i);
+}
+
+/************************** 性能测试 **************************/
+
+/**
+ * @brief 依次使用标量与 SIMD 实现执行一种转换，输出两者耗时（微秒）
+ */
+#define CONV_BENCH(name, call, out, out_size)                                         \
+    do                                                                                \
+    {                                                                                 \
+        uint64_t t_us[2];                                                             \
+        for (int simd = 0; simd < 2; simd++)                                          \
+        {                                                                             \
+            eos_img_conv_set_simd(simd);                                              \
+            uint64_t start = eos_perf_time_get_us();                                  \
+            for (uint32_t r = 0; r < rounds; r++)                                     \
+                call;                                                                 \
+            t_us[simd] = eos_perf_time_get_us() - start;                              \
+            if (!simd)                                                                \
+                memcpy(ref, out, out_size);                                           \
+        }                                                                             \
+        EOS_LOG_I("%-16s scalar %8" PRIu64 " us | %-6s %8" PRIu64 " us | %s", name,   \
+                  t_us[0], eos_img_conv_backend(), t_us[1],                           \
+                  memcmp(ref, out, out_size) == 0 ? "match" : "MISMATCH");            \
+    } while (0)
+
+void eos_img_conv_benchmark(uint32_t pixels, uint32_t rounds)
+{
+    uint8_t *src = eos_malloc_large(pixels * 4);
+    uint8_t *dst = eos_malloc_large(pixels * 4);
+    uint8_t *ref = eos_malloc_large(pixels * 4);
+    if (!src || !dst || !ref)
+    {
+        EOS_LOG_E("Benchmark buffer alloc failed");
+        goto cleanup;
+    }
+    // 固定种子的伪随机数据，覆盖全部 Alpha 取值
+    uint32_t seed = 0x12345678;
+    for (uint32_t i = 0; i < pixels * 4; i++)
+    {
+        seed = seed * 1664525 + 1013904223;
+        src[i] = (uint8_t)(seed >> 24);
+    }
+
+    bool simd_enabled = conv_simd_enabled;
+    EOS_LOG_I("Image conversion benchmark: %" PRIu32 " px x %" PRIu32 " rounds", pixels, rounds);
+    CONV_BENCH("rgb565_swap", eos_img_conv_rgb565_swap((const uint16_t *)src, (uint16_t *)dst, pixels * 2),
+               dst, pixels * 4);
+    CONV_BENCH("premultiply", eos_img_conv_argb8888_premultiply(src, dst, pixels),
+               dst, pixels * 4);
+    CONV_BENCH("to_rgb565a8", eos_img_conv_argb8888_to_rgb565a8(src, (uint16_t *)dst, dst + pixels * 2, pixels),
+               dst, pixels * 3);
+    eos_img_conv_set_simd(simd_enabled);
+
+cleanup:
+    if (src)
+        eos_free_large(src);
+    if (dst)
+        eos_free_large(dst);
+    if (ref)
+        eos_free_large(ref);
+}
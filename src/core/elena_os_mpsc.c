@@ -0,0 +1,97 @@
+/**
+ * @file elena_os_mpsc.c
+ * @brief 无锁多生产者单消费者环形队列
+ * @author Sab1e
+ * @date 2025-10-02
+ *
+ * 每个槽位带有序号：序号等于写入位置时可写，等于写入位置 + 1 时可读。
+ * 生产者通过 CAS 抢占写入位置后独占槽位，写完数据再发布序号，
+ * 消费者读完数据后把序号推进一圈，将槽位交还给生产者。
+ */
+
+#include "elena_os_mpsc.h"
+
+// Includes
+#include <string.h>
+#include "elena_os_log.h"
+// Macros and Definitions
+
+// Variables
+
+// Function Implementations
+eos_result_t eos_mpsc_init(eos_mpsc_t *q, eos_mpsc_slot_t *slots, size_t capacity)
+{
+    if (!q || !slots)
+        return -EOS_ERR_VAR_NULL;
+    if (capacity < 2 || (capacity & (capacity - 1)) != 0)
+    {
+        EOS_LOG_E("MPSC capacity must be a power of 2: %zu", capacity);
+        return -EOS_FAILED;
+    }
+    for (size_t i = 0; i < capacity; i++)
+    {
+        atomic_init(&slots[i].seq, i);
+    }
+    q->mask = capacity - 1;
+    q->tail = 0;
+    atomic_init(&q->head, 0);
+    q->slots = slots;
+    return EOS_OK;
+}
+
+bool eos_mpsc_push(eos_mpsc_t *q, uint32_t code, const void *data, size_t size)
+{
+    if (!q || !q->slots || size > EOS_MPSC_PAYLOAD_SIZE)
+        return false;
+
+    eos_mpsc_slot_t *slot;
+    size_t pos = atomic_load_explicit(&q->head, memory_order_relaxed);
+    while (1)
+    {
+        slot = &q->slots[pos & q->mask];
+        size_t seq = atomic_load_explicit(&slot->seq, memory_order_acquire);
+        intptr_t dif = (intptr_t)seq - (intptr_t)pos;
+        if (dif == 0)
+        {
+            // 槽位空闲，抢占写入位置；失败时 pos 被更新为最新值
+            if (atomic_compare_exchange_weak_explicit(&q->head, &pos, pos + 1,
+                                                      memory_order_relaxed, memory_order_relaxed))
+                break;
+        }
+        else if (dif < 0)
+        {
+            // 槽位仍未被消费者读取：队列已满
+            return false;
+        }
+        else
+        {
+            pos = atomic_load_explicit(&q->head, memory_order_relaxed);
+        }
+    }
+
+    slot->msg.code = code;
+    slot->msg.size = (uint32_t)size;
+    if (data && size)
+        memcpy(slot->msg.data, data, size);
+    atomic_store_explicit(&slot->seq, pos + 1, memory_order_release);
+    return true;
+}
+
+bool eos_mpsc_pop(eos_mpsc_t *q, eos_mpsc_msg_t *msg)
+{
+    if (!q || !q->slots || !msg)
+        return false;
+
+    size_t pos = q->tail;
+    eos_mpsc_slot_t *slot = &q->slots[pos & q->mask];
+    size_t seq = atomic_load_explicit(&slot->seq, memory_order_acquire);
+    if (seq != pos + 1)
+        return false; // 为空，或生产者已抢占但尚未写完
+
+    msg->code = slot->msg.code;
+    msg->size = slot->msg.size;
+    memcpy(msg->data, slot->msg.data, msg->size);
+    atomic_store_explicit(&slot->seq, pos + q->mask + 1, memory_order_release);
+    q->tail = pos + 1;
+    return true;
+}
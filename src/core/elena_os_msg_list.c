@@ -507,12 +507,12 @@ msg_list_item_t *eos_msg_list_item_create(msg_list_t *list)
     lv_obj_set_flex_align(item->row1, LV_FLEX_ALIGN_START, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_SPACE_BETWEEN);
     // 图标区域
     item->icon = lv_image_create(item->row1);
-    lv_obj_set_size(item->icon, 64, 64);
+    lv_obj_set_size(item->icon, EOS_IMG_SIZE_LIST_ICON, EOS_IMG_SIZE_LIST_ICON);
     lv_obj_set_style_bg_opa(item->icon, LV_OPA_TRANSP, 0);
     lv_obj_set_style_border_width(item->icon, 0, 0);
     lv_obj_set_flex_align(item->icon, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER);
     lv_obj_remove_flag(item->icon, LV_OBJ_FLAG_SCROLLABLE);
-    eos_img_set_src(item->icon, EOS_IMG_APP);
+    eos_img_set_src_sized(item->icon, EOS_IMG_APP, EOS_IMG_SIZE_LIST_ICON, EOS_IMG_SIZE_LIST_ICON);
 
     // 标题
     item->title_label = lv_label_create(item->row1);
@@ -626,7 +626,7 @@ void eos_msg_list_item_set_time(msg_list_item_t *item, const char *time)
 void eos_msg_list_item_icon_set_src(msg_list_item_t *item, const char *src)
 {
     EOS_CHECK_PTR_RETURN(item && src);
-    eos_img_set_src(item->icon, src);
+    eos_img_set_src_sized(item->icon, src, EOS_IMG_SIZE_LIST_ICON, EOS_IMG_SIZE_LIST_ICON);
 }
 
 void eos_msg_list_clear_all(msg_list_t *msg_list)
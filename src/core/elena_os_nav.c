@@ -10,58 +10,61 @@
 // Includes
 #include <stdio.h>
 #include <stdlib.h>
-#include <stdatomic.h>
+#include <string.h>
 #include "elena_os_log.h"
 #include "elena_os_core.h"
-#include "script_engine_core.h"
-#include "script_engine_nav.h"
+#include "elena_os_event.h"
+#include "elena_os_config.h"
+#include "elena_os_port.h"
+#include "elena_os_trace.h"
 // Macros and Definitions
 #define NAV_STACK_SIZE 32
+#ifndef EOS_NAV_KEEP_ALIVE_COUNT
+#define EOS_NAV_KEEP_ALIVE_COUNT 3
+#endif /* EOS_NAV_KEEP_ALIVE_COUNT */
+/**
+ * @brief 栈中的页面
+ */
+typedef struct
+{
+    lv_obj_t *scr;
+    eos_nav_owner_t owner;
+} nav_entry_t;
 /**
  * @brief 导航栈结构体
+ *
+ * 压栈、出栈立即修改栈内容，页面加载与删除延迟到每帧一次的提交中按顺序执行，
+ * 同一帧内的多次操作只加载最终的栈顶页面
  */
 typedef struct
 {
-    lv_obj_t *stack[NAV_STACK_SIZE];
+    nav_entry_t stack[NAV_STACK_SIZE];
     int8_t top;
     bool initialized;
+    lv_obj_t *release[NAV_STACK_SIZE];  // 待删除的页面（按出栈顺序）
+    uint8_t release_count;
+    bool dirty;                         // 有未提交的操作
+    eos_anim_scr_load_t anim;           // 提交时加载栈顶使用的动画
+    uint32_t anim_duration;
+    lv_timer_t *timer;                  // 提交定时器，空闲时暂停
 } nav_stack_t;
 /**
- * @brief 导航正忙，等待响应
- */
-#define NAV_BUSY_WAIT()                                                   \
-    do                                                                    \
-    {                                                                     \
-        bool expected = false;                                            \
-        while (!atomic_compare_exchange_weak(&nav_busy, &expected, true)) \
-        {                                                                 \
-            expected = false;                                             \
-            EOS_LOG_D("Waiting for nav stack to be available");           \
-            lv_timer_handler();                                           \
-        }                                                                 \
-    } while (0)
-/**
- * @brief 导航正忙，取消操作
+ * @brief 带 key 的页面记录，返回时保留页面对象以便再次进入时复用
  */
-#define NAV_BUSY_CHECK()                                                 \
-    do                                                                   \
-    {                                                                    \
-        bool expected = false;                                           \
-        if (!atomic_compare_exchange_strong(&nav_busy, &expected, true)) \
-        {                                                                \
-            EOS_LOG_D("Nav stack busy, operation rejected");             \
-            return -EOS_ERR_BUSY;                                        \
-        }                                                                \
-    } while (0)
+typedef struct _nav_keyed_t
+{
+    lv_obj_t *scr;
+    char *key;
+    bool cached;                // 已出栈，保留在缓存中
+    uint32_t last_used;         // 出栈时间戳，用于 LRU 淘汰
+    struct _nav_keyed_t *next;
+} nav_keyed_t;
 // Variables
 static nav_stack_t nav = {.top = -1, .initialized = false};
-static atomic_bool nav_busy = false; // 正在清除
+static nav_keyed_t *nav_keyed_head = NULL;
+static uint32_t nav_keyed_tick = 0;
+static uint32_t nav_commit_seq = 0; // 提交次数
 // Function Implementations
-static lv_obj_t *_nav_peek_prev(void);
-static bool _is_nav_stack_initialized(void);
-static bool _is_nav_stack_full(void);
-static bool _is_nav_stack_empty(void);
-eos_result_t eos_nav_back_clean(void);
 extern lv_style_t style_screen;
 /**
  * @brief 检查导航栈是否已初始化
@@ -79,70 +82,208 @@ static bool _is_nav_stack_full(void)
     return nav.top >= NAV_STACK_SIZE - 1;
 }
 
+static bool _nav_stack_contains(lv_obj_t *scr)
+{
+    for (int i = 0; i <= nav.top; i++)
+    {
+        if (nav.stack[i].scr == scr)
+            return true;
+    }
+    return false;
+}
+
+static nav_keyed_t *_nav_keyed_find_scr(lv_obj_t *scr)
+{
+    for (nav_keyed_t *k = nav_keyed_head; k; k = k->next)
+    {
+        if (k->scr == scr)
+            return k;
+    }
+    return NULL;
+}
+
+/**
+ * @brief 页面删除时移除记录
+ */
+static void _nav_keyed_delete_cb(lv_event_t *e)
+{
+    nav_keyed_t *keyed = (nav_keyed_t *)lv_event_get_user_data(e);
+    nav_keyed_t **curr = &nav_keyed_head;
+    while (*curr)
+    {
+        if (*curr == keyed)
+        {
+            *curr = keyed->next;
+            break;
+        }
+        curr = &(*curr)->next;
+    }
+    lv_free(keyed->key);
+    lv_free(keyed);
+}
+
 /**
- * @brief 检查导航栈是否为空
+ * @brief 缓存的页面超过上限时，删除最久未使用的页面
+ * @note 尚未提交、仍在显示的页面不会被删除
  */
-static bool _is_nav_stack_empty(void)
+static void _nav_keep_alive_trim(uint32_t retain)
 {
-    return nav.top < 0;
+    lv_obj_t *active = lv_screen_active();
+    while (1)
+    {
+        uint32_t count = 0;
+        nav_keyed_t *victim = NULL;
+        for (nav_keyed_t *k = nav_keyed_head; k; k = k->next)
+        {
+            if (!k->cached)
+                continue;
+            count++;
+            if (k->scr != active && (!victim || k->last_used < victim->last_used))
+                victim = k;
+        }
+        if (count <= retain || !victim)
+            return;
+        EOS_LOG_D("Keep-alive evict: %s", victim->key);
+        lv_obj_del(victim->scr); // 删除回调中释放记录
+    }
 }
 
 /**
- * @brief 获取前一个页面对象
+ * @brief 内存紧张、主题或语言变化时丢弃缓存的页面
  */
-static lv_obj_t *_nav_peek_prev(void)
+static void _nav_keep_alive_clear_cb(lv_event_t *e)
 {
-    EOS_LOG_D("NAV PREV");
-    return (nav.top > 0) ? nav.stack[nav.top - 1] : NULL;
+    EOS_UNUSED(e);
+    eos_nav_keep_alive_clear();
 }
 
-eos_result_t eos_nav_init(lv_obj_t *root_scr)
+/**
+ * @brief 提交未完成的操作：加载栈顶页面，再删除出栈的页面
+ */
+static void _nav_commit(void)
 {
-    if (!root_scr)
+    if (!nav.dirty)
+        return;
+    EOS_TRACE_SCOPE("nav_commit");
+    nav.dirty = false;
+    nav_commit_seq++;
+    lv_timer_pause(nav.timer);
+
+    lv_obj_t *top = nav.stack[nav.top].scr;
+    if (lv_screen_active() != top)
     {
-        EOS_LOG_E("Root screen is NULL");
-        return -EOS_ERR_VAR_NULL;
+        if (nav.anim != EOS_ANIM_SCR_LOAD_NONE)
+            eos_anim_scr_load(top, nav.anim, nav.anim_duration, false);
+        else
+            lv_screen_load(top);
     }
+    nav.anim = EOS_ANIM_SCR_LOAD_NONE;
 
-    if (_is_nav_stack_initialized())
+    // 页面可能在删除前被再次压栈
+    for (uint8_t i = 0; i < nav.release_count; i++)
     {
-        EOS_LOG_E("Nav stack already initialized");
-        return -EOS_ERR_ALREADY_INITIALIZED;
+        lv_obj_t *scr = nav.release[i];
+        if (!_nav_stack_contains(scr))
+        {
+            lv_obj_del(scr);
+            EOS_LOG_D("Deleted screen at %p", scr);
+        }
     }
+    nav.release_count = 0;
+    _nav_keep_alive_trim(EOS_NAV_KEEP_ALIVE_COUNT);
+    EOS_MEM("Nav commit");
+}
 
-    // 设置root screen并初始化栈
-    nav.stack[0] = root_scr;
-    nav.top = 0;
-    nav.initialized = true;
+static void _nav_timer_cb(lv_timer_t *timer)
+{
+    EOS_UNUSED(timer);
+    _nav_commit();
+}
 
-    // 确保root screen是活动屏幕
-    lv_scr_load(root_scr);
-    lv_obj_add_style(root_scr, &style_screen, 0);
-    EOS_LOG_D("Nav stack initialized with root screen %p", root_scr);
-    return EOS_OK;
+/**
+ * @brief 标记有未提交的操作，在下一次 lv_timer_handler 中提交
+ */
+static void _nav_schedule(void)
+{
+    nav.dirty = true;
+    lv_timer_resume(nav.timer);
+    lv_timer_ready(nav.timer);
 }
 
-lv_obj_t *eos_nav_scr_create(void)
+static eos_result_t _nav_push(lv_obj_t *scr, eos_nav_owner_t owner, eos_anim_scr_load_t anim, uint32_t duration)
 {
-    if (nav_busy)
+    if (!_is_nav_stack_initialized())
     {
-        EOS_LOG_E("Nav stack busy");
-        return NULL;
+        EOS_LOG_E("Nav stack not initialized");
+        return -EOS_ERR_NOT_INITIALIZED;
+    }
+    if (_is_nav_stack_full())
+    {
+        EOS_LOG_E("Nav stack full");
+        return -EOS_ERR_STACK_FULL;
     }
-    atomic_store(&nav_busy, true);
+    if (_nav_stack_contains(scr))
+    {
+        EOS_LOG_E("Screen already in nav stack: %p", scr);
+        return -EOS_FAILED;
+    }
+    EOS_LOG_D("NAV PUSH: %p", scr);
+    EOS_TRACE_INSTANT("nav_push");
+    nav.top++;
+    nav.stack[nav.top].scr = scr;
+    nav.stack[nav.top].owner = owner;
+    nav.anim = anim;
+    nav.anim_duration = duration;
+    _nav_schedule();
+    return EOS_OK;
+}
 
+/**
+ * @brief 弹出栈顶页面
+ * @param release 是否释放页面：不带 key 的页面在提交时删除；带 key 的页面总是放入缓存
+ */
+static eos_result_t _nav_pop(bool release)
+{
     if (!_is_nav_stack_initialized())
     {
         EOS_LOG_E("Nav stack not initialized");
-        return NULL;
+        return -EOS_ERR_NOT_INITIALIZED;
     }
-
-    if (_is_nav_stack_full())
+    if (nav.top <= 0)
     {
-        EOS_LOG_E("Nav stack full");
-        return NULL;
+        EOS_LOG_E("Nav stack empty (cannot back from root screen)");
+        return -EOS_ERR_STACK_EMPTY;
+    }
+    lv_obj_t *scr = nav.stack[nav.top].scr;
+    nav.stack[nav.top].scr = NULL;
+    nav.top--;
+    nav.anim = EOS_ANIM_SCR_LOAD_NONE;
+    EOS_LOG_D("NAV POP: %p", scr);
+    EOS_TRACE_INSTANT("nav_pop");
+
+    // 带 key 的页面无论是否释放都放回缓存，否则之后同 key 创建会得到重复页面
+    nav_keyed_t *keyed = _nav_keyed_find_scr(scr);
+    if (keyed)
+    {
+        keyed->cached = true;
+        keyed->last_used = ++nav_keyed_tick;
+        EOS_LOG_D("Keep-alive: %s", keyed->key);
     }
+    else if (release)
+    {
+        if (nav.release_count >= NAV_STACK_SIZE)
+            _nav_commit();
+        nav.release[nav.release_count++] = scr;
+    }
+    _nav_schedule();
+    return EOS_OK;
+}
 
+/**
+ * @brief 创建带系统样式的空白页面
+ */
+static lv_obj_t *_nav_scr_new(void)
+{
     lv_obj_t *scr = lv_obj_create(NULL);
     if (!scr)
     {
@@ -150,141 +291,177 @@ lv_obj_t *eos_nav_scr_create(void)
         return NULL;
     }
     lv_obj_add_style(scr, &style_screen, 0);
-    // 确保新屏幕与栈中已有屏幕地址不同
-    for (int i = 0; i <= nav.top; i++)
-    {
-        if (nav.stack[i] == scr)
-        {
-            EOS_LOG_E("New screen address conflicts with existing screen!");
-            lv_obj_del(scr);
-            return NULL;
-        }
-    }
-
-    EOS_LOG_D("NAV PUSH: new screen at %p", scr);
-    nav.stack[++nav.top] = scr;
-    EOS_MEM("Create new scr");
-    atomic_store(&nav_busy, false);
     return scr;
 }
 
-eos_result_t eos_nav_clear_stack(void)
+eos_result_t eos_nav_init(lv_obj_t *root_scr)
 {
-    if (nav_busy)
+    if (!root_scr)
     {
-        EOS_LOG_E("Nav stack busy");
-        return -EOS_ERR_BUSY;
+        EOS_LOG_E("Root screen is NULL");
+        return -EOS_ERR_VAR_NULL;
     }
-    atomic_store(&nav_busy, true);
 
-    if (!_is_nav_stack_initialized())
+    if (_is_nav_stack_initialized())
     {
-        EOS_LOG_E("Nav stack not initialized");
-        return -EOS_ERR_NOT_INITIALIZED;
+        EOS_LOG_E("Nav stack already initialized");
+        return -EOS_ERR_ALREADY_INITIALIZED;
     }
 
-    if (_is_nav_stack_empty())
+    nav.timer = lv_timer_create(_nav_timer_cb, 0, NULL);
+    if (!nav.timer)
     {
-        EOS_LOG_D("Nav stack already empty (only root screen remains)");
-        return EOS_OK;
-    }
-
-    // 从栈顶向下清理，跳过栈底(root screen)
-    for (int i = nav.top; i > 0; i--)
-    { // 注意从i>0开始
-        if (nav.stack[i] != NULL)
-        {
-            lv_obj_t *scr = nav.stack[i];
-            nav.stack[i] = NULL;
-            lv_obj_del(scr);
-            EOS_LOG_D("Cleared screen at stack position %d", i);
-        }
+        EOS_LOG_E("Create nav timer failed");
+        return -EOS_FAILED;
     }
+    lv_timer_pause(nav.timer);
 
-    // 重置栈顶指针（保留root screen在位置0）
+    // 设置root screen并初始化栈
+    nav.stack[0].scr = root_scr;
+    nav.stack[0].owner = EOS_NAV_OWNER_SYS;
     nav.top = 0;
+    nav.initialized = true;
 
     // 确保root screen是活动屏幕
-    lv_scr_load(nav.stack[0]);
-    atomic_store(&nav_busy, false);
+    lv_scr_load(root_scr);
+    lv_obj_add_style(root_scr, &style_screen, 0);
+    eos_event_add_cb(root_scr, _nav_keep_alive_clear_cb, eos_event_get_code(EOS_EVENT_LOW_MEMORY), NULL);
+    eos_event_add_cb(root_scr, _nav_keep_alive_clear_cb, eos_event_get_code(EOS_EVENT_THEME_UPDATED), NULL);
+    eos_event_add_cb(root_scr, _nav_keep_alive_clear_cb, LV_EVENT_REFRESH, NULL); // 语言切换
+    EOS_LOG_D("Nav stack initialized with root screen %p", root_scr);
     return EOS_OK;
 }
 
-eos_result_t eos_nav_back_clean(void)
+bool eos_nav_is_initialized(void)
+{
+    return _is_nav_stack_initialized();
+}
+
+lv_obj_t *eos_nav_scr_create(void)
+{
+    if (!_is_nav_stack_initialized() || _is_nav_stack_full())
+    {
+        EOS_LOG_E("Nav stack unavailable");
+        return NULL;
+    }
+    lv_obj_t *scr = _nav_scr_new();
+    if (!scr)
+        return NULL;
+    if (_nav_push(scr, EOS_NAV_OWNER_SYS, EOS_ANIM_SCR_LOAD_NONE, 0) != EOS_OK)
+    {
+        lv_obj_del(scr);
+        return NULL;
+    }
+    EOS_MEM("Create new scr");
+    return scr;
+}
+
+eos_result_t eos_nav_push(lv_obj_t *scr, eos_nav_owner_t owner, eos_anim_scr_load_t anim, uint32_t duration)
 {
-    NAV_BUSY_CHECK();
+    EOS_CHECK_PTR_RETURN_VAL(scr, -EOS_ERR_VAR_NULL);
+    return _nav_push(scr, owner, anim, duration);
+}
 
+lv_obj_t *eos_nav_top(void)
+{
+    return _is_nav_stack_initialized() ? nav.stack[nav.top].scr : NULL;
+}
+
+uint32_t eos_nav_commit_seq(void)
+{
+    return nav_commit_seq;
+}
+
+eos_result_t eos_nav_clear_stack(void)
+{
     if (!_is_nav_stack_initialized())
     {
         EOS_LOG_E("Nav stack not initialized");
-        atomic_store(&nav_busy, false);
         return -EOS_ERR_NOT_INITIALIZED;
     }
-
-    if (_is_nav_stack_empty())
+    // 从栈顶向下清理，跳过栈底(root screen)
+    while (nav.top > 0)
     {
-        EOS_LOG_E("Nav stack empty (cannot back from root screen)");
-        atomic_store(&nav_busy, false);
-        return -EOS_ERR_STACK_EMPTY;
+        _nav_pop(true);
     }
-    if (nav.top == 0)
+    return EOS_OK;
+}
+
+eos_result_t eos_nav_clear_owner(eos_nav_owner_t owner)
+{
+    if (!_is_nav_stack_initialized())
     {
-        EOS_LOG_E("Root screen");
-        return -EOS_FAILED;
+        EOS_LOG_E("Nav stack not initialized");
+        return -EOS_ERR_NOT_INITIALIZED;
     }
-    // 直接执行回退逻辑
-    lv_obj_t *prev_scr = _nav_peek_prev();
-    if (!prev_scr)
+    while (nav.top > 0 && nav.stack[nav.top].owner == owner)
     {
-        prev_scr = nav.stack[0]; // 回退到 root screen
+        _nav_pop(true);
     }
+    return EOS_OK;
+}
 
-    // 保存要删除的页面
-    lv_obj_t *scr_to_del = nav.stack[nav.top];
-    nav.top--; // 更新栈指针
-
-    // 删除页面
-    if (scr_to_del)
-    {
-        lv_obj_del(scr_to_del);
-        EOS_LOG_D("Deleted screen at %p", scr_to_del);
-    }
+eos_result_t eos_nav_back_clean(void)
+{
+    return _nav_pop(true);
+}
 
-    // 加载前一个屏幕
-    lv_scr_load(prev_scr);
+eos_result_t eos_nav_back(void)
+{
+    return _nav_pop(false);
+}
 
-    EOS_MEM("Clear scr");
-    atomic_store(&nav_busy, false);
-    return EOS_OK;
+void eos_nav_flush(void)
+{
+    _nav_commit();
 }
 
-eos_result_t eos_nav_back(void)
+lv_obj_t *eos_nav_scr_create_keyed(const char *key, bool *reused)
 {
-    NAV_BUSY_CHECK();
+    EOS_CHECK_PTR_RETURN_VAL(key, NULL);
+    if (reused)
+        *reused = false;
 
-    if (!_is_nav_stack_initialized())
+    nav_keyed_t *keyed = NULL;
+    for (nav_keyed_t *k = nav_keyed_head; k; k = k->next)
     {
-        EOS_LOG_E("Nav stack not initialized");
-        atomic_store(&nav_busy, false);
-        return -EOS_ERR_NOT_INITIALIZED;
+        if (k->cached && strcmp(k->key, key) == 0)
+        {
+            keyed = k;
+            break;
+        }
     }
-
-    if (_is_nav_stack_empty())
+    if (keyed)
     {
-        EOS_LOG_E("Already at root screen, cannot go back");
-        atomic_store(&nav_busy, false);
-        return -EOS_ERR_STACK_EMPTY;
+        if (_nav_push(keyed->scr, EOS_NAV_OWNER_SYS, EOS_ANIM_SCR_LOAD_NONE, 0) != EOS_OK)
+            return NULL;
+        keyed->cached = false;
+        EOS_LOG_D("NAV PUSH: reuse %s at %p", key, keyed->scr);
+        if (reused)
+            *reused = true;
+        return keyed->scr;
     }
 
-    lv_obj_t *prev_scr = _nav_peek_prev();
-    if (!prev_scr)
+    lv_obj_t *scr = eos_nav_scr_create();
+    if (!scr)
+        return NULL;
+    keyed = (nav_keyed_t *)lv_malloc_zeroed(sizeof(nav_keyed_t));
+    if (!keyed)
+        return scr; // 无法缓存时退化为普通页面
+    keyed->key = lv_strdup(key);
+    if (!keyed->key)
     {
-        prev_scr = nav.stack[0]; // 回退到 root screen
+        lv_free(keyed);
+        return scr;
     }
+    keyed->scr = scr;
+    keyed->next = nav_keyed_head;
+    nav_keyed_head = keyed;
+    lv_obj_add_event_cb(scr, _nav_keyed_delete_cb, LV_EVENT_DELETE, keyed);
+    return scr;
+}
 
-    nav.top--; // 更新栈指针
-    lv_scr_load(prev_scr);
-
-    atomic_store(&nav_busy, false);
-    return EOS_OK;
+void eos_nav_keep_alive_clear(void)
+{
+    _nav_keep_alive_trim(0);
 }
\ No newline at end of file
@@ -24,7 +24,7 @@ static void _swipe_panel_event_cb_pressed(lv_event_t *e)
 {
     swipe_panel_t *swipe_panel = lv_event_get_user_data(e);
     EOS_CHECK_PTR_RETURN(swipe_panel);
-    eos_event_broadcast(eos_event_get_code(EOS_EVENT_SWIPE_PANEL_TOUCH_LOCK), NULL);
+    eos_event_post(eos_event_get_code(EOS_EVENT_SWIPE_PANEL_TOUCH_LOCK), NULL);
     if (active_swipe_panel != NULL && active_swipe_panel != swipe_panel)
     {
         return;
@@ -102,7 +102,7 @@ static void _swipe_panel_event_cb_pressing(lv_event_t *e)
 static void _swipe_panel_timer_cb(lv_timer_t * timer)
 {
     EOS_LOG_D("Timer Callback");
-    eos_event_broadcast(eos_event_get_code(EOS_EVENT_SWIPE_PANEL_TOUCH_UNLOCK), NULL);
+    eos_event_post(eos_event_get_code(EOS_EVENT_SWIPE_PANEL_TOUCH_UNLOCK), NULL);
 }
 
 static void _swipe_panel_anim_completed_cb(lv_anim_t *a)
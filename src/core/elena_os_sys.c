@@ -34,23 +34,42 @@
 #include "elena_os_test.h"
 #include "elena_os_version.h"
 #include "elena_os_port.h"
+#include "elena_os_trace.h"
 #include "elena_os_swipe_panel.h"
 #include "elena_os_app.h"
 #include "elena_os_watchface.h"
 #include "elena_os_misc.h"
 #include "elena_os_theme.h"
 #include "elena_os_pkg_mgr.h"
+#include "elena_os_boot.h"
 // Macros and Definitions
 #define EOS_SYS_DEFAULT_LANG_STR "English"
 #define EOS_SYS_DEFAULT_WATCHFACE_ID_STR "cn.sab1e.clock"
 #define EOS_SYS_DISPLAY_BRIGHTNESS_MIN 1 /**< 亮度为0即关闭屏幕 */
 #define EOS_SYS_DISPLAY_BRIGHTNESS_MAX 100
+#define EOS_SYS_IMG_VARIANT_PERIOD 200 // 生成内置图片变体的间隔（ms），每次只生成一个
+/**
+ * @brief 内置图片的预缩放变体
+ */
+typedef struct
+{
+    const char *path;
+    uint32_t size;
+} sys_img_variant_t;
 // Variables
+static const sys_img_variant_t sys_img_variants[] = {
+    {EOS_IMG_APP, EOS_IMG_SIZE_APP_ICON},
+    {EOS_IMG_APP, EOS_IMG_SIZE_LIST_ICON},
+    {EOS_IMG_SETTINGS, EOS_IMG_SIZE_APP_ICON},
+    {EOS_IMG_SETTINGS, EOS_IMG_SIZE_LIST_ICON},
+};
+static uint32_t sys_img_variant_index = 0;
 
 // Function Implementations
 
 eos_result_t eos_sys_cfg_set_bool(const char *key, bool value)
 {
+    EOS_TRACE_SCOPE("cfg_set");
     if (!key)
     {
         EOS_LOG_E("Invalid parameter: key is NULL");
@@ -146,6 +165,7 @@ eos_result_t eos_sys_cfg_set_bool(const char *key, bool value)
 
 eos_result_t eos_sys_cfg_set_string(const char *key, const char *value)
 {
+    EOS_TRACE_SCOPE("cfg_set");
     if (!key || !value)
     {
         EOS_LOG_E("Invalid parameters: key or value is NULL");
@@ -241,6 +261,7 @@ eos_result_t eos_sys_cfg_set_string(const char *key, const char *value)
 
 eos_result_t eos_sys_cfg_set_number(const char *key, double value)
 {
+    EOS_TRACE_SCOPE("cfg_set");
     if (!key)
     {
         EOS_LOG_E("Invalid parameter: key is NULL");
@@ -336,6 +357,7 @@ eos_result_t eos_sys_cfg_set_number(const char *key, double value)
 
 bool eos_sys_cfg_get_bool(const char *key, bool default_value)
 {
+    EOS_TRACE_SCOPE("cfg_get");
     if (!key)
     {
         EOS_LOG_E("Invalid parameter: key is NULL");
@@ -412,6 +434,7 @@ bool eos_sys_cfg_get_bool(const char *key, bool default_value)
 
 char *eos_sys_cfg_get_string(const char *key, const char *default_value)
 {
+    EOS_TRACE_SCOPE("cfg_get");
     if (!key)
     {
         EOS_LOG_E("Invalid parameter: key is NULL");
@@ -494,6 +517,7 @@ char *eos_sys_cfg_get_string(const char *key, const char *default_value)
 
 double eos_sys_cfg_get_number(const char *key, double default_value)
 {
+    EOS_TRACE_SCOPE("cfg_get");
     if (!key)
     {
         EOS_LOG_E("Invalid parameter: key is NULL");
@@ -598,6 +622,22 @@ eos_result_t _create_default_cfg_json(const char *path)
     return ret;
 }
 
+/**
+ * @brief 启动后逐个生成内置图片的变体，生成前显示时使用原图缩放
+ * @note 渲染需要 LVGL，不能放到启动后台线程中
+ */
+static void _sys_img_variant_timer_cb(lv_timer_t *timer)
+{
+    if (sys_img_variant_index >= sizeof(sys_img_variants) / sizeof(sys_img_variants[0]))
+    {
+        lv_timer_delete(timer);
+        return;
+    }
+    const sys_img_variant_t *v = &sys_img_variants[sys_img_variant_index++];
+    EOS_TRACE_SCOPE("img_variant");
+    eos_img_variant_generate(v->path, v->size, v->size);
+}
+
 void eos_sys_init()
 {
     // 判断系统文件是否存在
@@ -633,6 +673,10 @@ void eos_sys_init()
     if (brightness < 1 || brightness > 100)
         brightness = 50;
     eos_display_set_brightness(brightness);
+
+    /************************** 生成内置图片的预缩放变体 **************************/
+    // 不阻塞启动，之后在 UI 线程中每次生成一个
+    lv_timer_create(_sys_img_variant_timer_cb, EOS_SYS_IMG_VARIANT_PERIOD, NULL);
 }
 
 /**
@@ -766,7 +810,6 @@ static void _sys_screen_bluetooth(lv_event_t *e)
 {
     lv_obj_t *scr = eos_nav_scr_create();
     eos_screen_bind_header(scr, current_lang[STR_ID_SETTINGS_BLUETOOTH]);
-    lv_screen_load(scr);
 
     lv_obj_t *list = lv_list_create(scr);
     lv_obj_set_size(list, lv_pct(100), lv_pct(100));
@@ -828,7 +871,6 @@ static void _sys_screen_display(lv_event_t *e)
 {
     lv_obj_t *scr = eos_nav_scr_create();
     eos_screen_bind_header(scr, current_lang[STR_ID_SETTINGS_DISPLAY]);
-    lv_screen_load(scr);
 
     lv_obj_t *list = lv_list_create(scr);
     lv_obj_set_size(list, lv_pct(100), lv_pct(100));
@@ -852,7 +894,6 @@ static void _sys_screen_notification(lv_event_t *e)
 {
     lv_obj_t *scr = eos_nav_scr_create();
     eos_screen_bind_header(scr, current_lang[STR_ID_SETTINGS_DISPLAY]);
-    lv_screen_load(scr);
 }
 /************************** 应用列表 **************************/
 
@@ -912,7 +953,6 @@ static void _sys_app_list_btn_cb(lv_event_t *e)
     // 创建新的页面用于绘制应用详情页
     lv_obj_t *scr = eos_nav_scr_create();
     eos_screen_bind_header(scr, pkg.name);
-    lv_screen_load(scr);
 
     lv_obj_t *list = lv_list_create(scr);
     lv_obj_set_size(list, lv_pct(100), lv_pct(100));
@@ -1035,10 +1075,14 @@ static void _app_installed_cb(lv_event_t *e)
  */
 static void _sys_screen_apps(lv_event_t *e)
 {
-    // 创建新的页面用于绘制应用列表
-    lv_obj_t *scr = eos_nav_scr_create();
+    // 创建新的页面用于绘制应用列表，返回后再次进入时直接复用
+    bool reused = false;
+    lv_obj_t *scr = eos_nav_scr_create_keyed("sys.settings.apps", &reused);
+    EOS_CHECK_PTR_RETURN(scr);
+    if (reused)
+        return;
+    eos_boot_wait();
     eos_screen_bind_header(scr, current_lang[STR_ID_SETTINGS_APPS]);
-    lv_screen_load(scr);
 
     lv_obj_t *app_list = lv_list_create(scr);
     lv_obj_set_size(app_list, lv_pct(100), lv_pct(100));
@@ -1058,9 +1102,12 @@ static void _sys_screen_apps(lv_event_t *e)
 /************************** 系统设置 **************************/
 void eos_sys_settings_create(void)
 {
-    lv_obj_t *scr = eos_nav_scr_create();
+    bool reused = false;
+    lv_obj_t *scr = eos_nav_scr_create_keyed("sys.settings", &reused);
+    EOS_CHECK_PTR_RETURN(scr);
+    if (reused)
+        return;
     eos_screen_bind_header(scr, current_lang[STR_ID_SETTINGS]);
-    lv_screen_load(scr);
 
     lv_obj_t *settings_list = lv_list_create(scr);
     lv_obj_set_size(settings_list, lv_pct(100), lv_pct(100));
@@ -19,6 +19,7 @@
 #include "elena_os_swipe_panel.h"
 #include "lvgl.h"
 #include "elena_os_img.h"
+#include "elena_os_img_conv.h"
 #include "elena_os_msg_list.h"
 #include "elena_os_lang.h"
 #include "elena_os_log.h"
@@ -32,6 +33,10 @@
 #include "script_engine_nav.h"
 #include "elena_os_misc.h"
 #include "elena_os_watchface_list.h"
+#include "elena_os_idle.h"
+#include "elena_os_trace.h"
+#include "elena_os_frame_stats.h"
+#include "elena_os_sys.h"
 // Macros and Definitions
 // #define TEST_USE_ZH_FONT
 #ifdef TEST_USE_ZH_FONT
@@ -46,7 +51,6 @@ extern script_pkg_t script_pkg; // 脚本包
 void _create_new_scr()
 {
     lv_obj_t *scr = eos_nav_scr_create();
-    lv_screen_load(scr);
 }
 
 static void _test_msg_list_cb(lv_event_t *e)
@@ -259,6 +263,25 @@ static void _test_watchface_list(){
     eos_watchface_list_create();
 }
 
+static void _test_img_conv_bench()
+{
+    // 一帧 466x466 的像素量
+    eos_img_conv_benchmark(466 * 466, 50);
+}
+
+static void _test_trace_dump()
+{
+    eos_trace_set_enabled(false);
+    eos_trace_dump(EOS_SYS_DIR "trace.json");
+    eos_trace_clear();
+    eos_trace_set_enabled(true);
+}
+
+static void _test_frame_stats()
+{
+    eos_frame_stats_overlay_set(!eos_frame_stats_overlay_is_shown());
+}
+
 void eos_test_start(void)
 {
 #ifdef DEBUG_USE_ZH_FONT
@@ -316,13 +339,24 @@ void eos_test_start(void)
     // 测试应用列表
     btn = lv_list_add_button(test_list, LV_SYMBOL_LIST, "Watchface List");
     lv_obj_add_event_cb(btn, _test_watchface_list, LV_EVENT_CLICKED, NULL);
+    // 测试图片格式转换性能
+    btn = lv_list_add_button(test_list, LV_SYMBOL_REFRESH, "Image Convert Bench");
+    lv_obj_add_event_cb(btn, _test_img_conv_bench, LV_EVENT_CLICKED, NULL);
+    // 导出性能追踪记录
+    btn = lv_list_add_button(test_list, LV_SYMBOL_SAVE, "Trace Dump");
+    lv_obj_add_event_cb(btn, _test_trace_dump, LV_EVENT_CLICKED, NULL);
+    // 切换帧统计浮层
+    btn = lv_list_add_button(test_list, LV_SYMBOL_EYE_OPEN, "Frame Stats");
+    lv_obj_add_event_cb(btn, _test_frame_stats, LV_EVENT_CLICKED, NULL);
 
     while (1)
     {
+        eos_event_dispatch_thread();
         uint32_t d = lv_timer_handler();
         if (script_engine_get_state()==SCRIPT_STATE_READY)
         {
             script_engine_nav_init(scr);
+            eos_idle_input_resume();
             script_engine_result_t ret = script_engine_run(&script_pkg);
             eos_pkg_free(&script_pkg);
             if (ret != SE_OK)
@@ -338,6 +372,6 @@ void eos_test_start(void)
             script_engine_nav_clean_up();
             EOS_LOG_D("Script OK");
         }
-        eos_delay(d);
+        eos_idle_sleep(d);
     }
 }
\ No newline at end of file
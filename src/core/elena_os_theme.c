@@ -12,6 +12,7 @@
 #include <stdlib.h>
 #include "lv_theme_private.h"
 #include "elena_os_log.h"
+#include "elena_os_event.h"
 // Macros and Definitions
 #define TEXT_COLOR lv_color_hex(0xffffff)
 /************************** Screen **************************/
@@ -145,4 +146,6 @@ void eos_theme_set(lv_color_t primary_color, lv_color_t secondary_color, const l
     lv_theme_set_apply_cb(&th_new, _theme_apply_cb);
 
     lv_display_set_theme(lv_display_get_default(), &th_new);
+    // 通知依赖主题的缓存（例如表盘静态层）重新生成
+    eos_event_broadcast(eos_event_get_code(EOS_EVENT_THEME_UPDATED), NULL);
 }
\ No newline at end of file
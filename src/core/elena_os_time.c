@@ -0,0 +1,283 @@
+/**
+ * @file elena_os_time.c
+ * @brief 时间服务（缓存 RTC 时间，在整秒 / 整分钟 / 跨天时通知订阅者）
+ * @author Sab1e
+ * @date 2025-10-09
+ *
+ * RTC 只提供秒级精度，通过观察秒值跳变的时刻（单调时钟）得到秒的相位，
+ * 之后定时器直接对齐到下一个整秒 / 整分钟。整分钟前提前 TIME_RETRY_MS 采样一次，
+ * 观察到跳变后重新校准相位，抵消 RTC 与单调时钟之间的漂移。
+ *
+ * RTC 通常通过 I2C 读取，eos_time_now 按已知的相位缓存读取结果直到下一个整秒，
+ * 每秒最多读取一次。只订阅日期时每个整点唤醒一次校准相位，跨天通知的延迟
+ * 不超过一小时内的漂移量。
+ */
+
+#include "elena_os_time.h"
+
+// Includes
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "lvgl.h"
+#include "elena_os_log.h"
+#include "elena_os_port.h"
+#include "elena_os_trace.h"
+// Macros and Definitions
+#define TIME_RETRY_MS 20        // 等待秒值跳变时的重试周期，也是相位的误差上限
+#define TIME_SUBS_INIT_CAP 4
+/**
+ * @brief 一个订阅
+ */
+typedef struct
+{
+    eos_time_unit_t unit;
+    eos_time_cb_t cb;       // 派发期间取消订阅时置空，派发结束后压缩
+    void *user_data;
+} time_sub_t;
+// Variables
+static time_sub_t *subs = NULL;
+static uint32_t sub_count = 0;
+static uint32_t sub_cap = 0;
+static uint32_t unit_counts[EOS_TIME_UNIT_COUNT] = {0};
+static uint32_t dispatching = 0;
+static bool has_removed = false;
+static lv_timer_t *time_timer = NULL;
+static eos_datetime_t cache_dt;    // 最近一次读取 RTC 的结果
+static uint64_t cache_us = 0;
+static bool cache_valid = false;
+static eos_datetime_t last_dt;      // 最近一次通知订阅者时的时间
+static uint64_t last_sample_us = 0;
+static bool last_valid = false;
+static uint64_t edge_us = 0;    // 最近一次观察到秒值跳变的时刻
+static bool edge_valid = false;
+static bool sample_early = false; // 本次唤醒是否为整分钟前的提前采样
+// Function Implementations
+static bool _day_changed(const eos_datetime_t *a, const eos_datetime_t *b)
+{
+    return a->day != b->day || a->month != b->month || a->year != b->year;
+}
+
+/**
+ * @brief 读取 RTC 并更新缓存
+ */
+static eos_datetime_t _time_sample(uint64_t now_us)
+{
+    EOS_TRACE_INSTANT("rtc_read");
+    cache_dt = eos_time_get();
+    cache_us = now_us;
+    cache_valid = true;
+    return cache_dt;
+}
+
+static bool _minute_changed(const eos_datetime_t *a, const eos_datetime_t *b)
+{
+    return a->min != b->min || a->hour != b->hour || a->day != b->day ||
+           a->month != b->month || a->year != b->year;
+}
+
+/**
+ * @brief 根据订阅情况设置下一次唤醒时间
+ */
+static void _time_schedule(uint64_t now_us, const eos_datetime_t *dt)
+{
+    // 只需唤醒到订阅中最小的单位
+    eos_time_unit_t finest = EOS_TIME_UNIT_COUNT;
+    for (int unit = EOS_TIME_UNIT_COUNT - 1; unit >= 0; unit--)
+    {
+        if (unit_counts[unit])
+            finest = (eos_time_unit_t)unit;
+    }
+    if (finest == EOS_TIME_UNIT_COUNT)
+    {
+        lv_timer_pause(time_timer);
+        return;
+    }
+    uint32_t period;
+    sample_early = false;
+    if (!edge_valid)
+    {
+        // 相位未知，短周期采样直到观察到秒值跳变
+        period = TIME_RETRY_MS;
+    }
+    else
+    {
+        uint32_t phase_ms = (uint32_t)(((now_us - edge_us) / 1000) % 1000);
+        period = 1000 - phase_ms;
+        if (finest >= EOS_TIME_UNIT_MINUTE)
+            period += (59 - dt->sec % 60) * 1000;
+        // 只订阅日期时每个整点唤醒一次，避免一天的漂移累积到秒级
+        if (finest >= EOS_TIME_UNIT_DAY)
+            period += (59 - dt->min % 60) * 60000;
+        // 下一次是整分钟时提前采样，以便观察到跳变并校准相位
+        bool minute_next = finest >= EOS_TIME_UNIT_MINUTE || dt->sec % 60 == 59;
+        if (minute_next && period > TIME_RETRY_MS)
+        {
+            period -= TIME_RETRY_MS;
+            sample_early = true;
+        }
+    }
+    lv_timer_set_period(time_timer, period);
+    lv_timer_reset(time_timer);
+    lv_timer_resume(time_timer);
+}
+
+static void _time_dispatch(eos_time_unit_t unit, const eos_datetime_t *dt)
+{
+    if (!unit_counts[unit])
+        return;
+    dispatching++;
+    uint32_t count = sub_count; // 回调中新增的订阅从下一次开始生效
+    for (uint32_t i = 0; i < count; i++)
+    {
+        if (subs[i].cb && subs[i].unit == unit)
+            subs[i].cb(dt, subs[i].user_data);
+    }
+    dispatching--;
+    if (!dispatching && has_removed)
+    {
+        uint32_t j = 0;
+        for (uint32_t i = 0; i < sub_count; i++)
+        {
+            if (subs[i].cb)
+                subs[j++] = subs[i];
+        }
+        sub_count = j;
+        has_removed = false;
+    }
+}
+
+static void _time_timer_cb(lv_timer_t *timer)
+{
+    EOS_UNUSED(timer);
+    EOS_TRACE_SCOPE("time_tick");
+    uint64_t now_us = eos_time_get_us();
+    eos_datetime_t dt = _time_sample(now_us);
+    bool day_changed = !last_valid || _day_changed(&dt, &last_dt);
+    bool min_changed = day_changed || _minute_changed(&dt, &last_dt);
+    bool sec_changed = min_changed || dt.sec != last_dt.sec;
+    bool rolled = unit_counts[EOS_TIME_UNIT_SECOND]   ? sec_changed
+                  : unit_counts[EOS_TIME_UNIT_MINUTE] ? min_changed
+                                                      : day_changed;
+    // 上一次采样足够近，或提前采样时已经进位（相位偏晚），本次即为跳变时刻的上界
+    bool pinned = sec_changed && last_valid &&
+                  (now_us - last_sample_us <= 2 * TIME_RETRY_MS * 1000 || (sample_early && rolled));
+    if (pinned)
+    {
+        edge_us = now_us;
+        edge_valid = true;
+    }
+    last_dt = dt;
+    last_sample_us = now_us;
+    last_valid = true;
+
+    if (!rolled)
+    {
+        // 提前到达：短周期重试直到观察到跳变，并重新校准相位
+        if (!pinned)
+            edge_valid = false;
+    }
+    if (sec_changed)
+        _time_dispatch(EOS_TIME_UNIT_SECOND, &dt);
+    if (min_changed)
+        _time_dispatch(EOS_TIME_UNIT_MINUTE, &dt);
+    if (day_changed)
+        _time_dispatch(EOS_TIME_UNIT_DAY, &dt);
+    _time_schedule(now_us, &dt);
+}
+
+void eos_time_init(void)
+{
+    if (time_timer)
+        return;
+    time_timer = lv_timer_create(_time_timer_cb, TIME_RETRY_MS, NULL);
+    lv_timer_pause(time_timer);
+    last_sample_us = eos_time_get_us();
+    last_dt = _time_sample(last_sample_us);
+    last_valid = true;
+}
+
+eos_datetime_t eos_time_now(void)
+{
+    uint64_t now_us = eos_time_get_us();
+    if (cache_valid)
+    {
+        // 相位已知时缓存到下一个整秒；否则只缓存一个重试周期，避免返回过期的秒数
+        bool fresh;
+        if (edge_valid && cache_us >= edge_us)
+            fresh = (now_us - edge_us) / 1000000 == (cache_us - edge_us) / 1000000;
+        else
+            fresh = now_us - cache_us < TIME_RETRY_MS * 1000;
+        if (fresh)
+            return cache_dt;
+    }
+    return _time_sample(now_us);
+}
+
+void eos_time_refresh(void)
+{
+    _time_sample(eos_time_get_us());
+    if (time_timer && !lv_timer_get_paused(time_timer))
+        lv_timer_ready(time_timer);
+}
+
+eos_result_t eos_time_subscribe(eos_time_unit_t unit, eos_time_cb_t cb, void *user_data)
+{
+    EOS_CHECK_PTR_RETURN_VAL(cb, -EOS_ERR_VAR_NULL);
+    EOS_CHECK_PTR_RETURN_VAL(time_timer, -EOS_FAILED);
+    if (unit >= EOS_TIME_UNIT_COUNT)
+        return -EOS_FAILED;
+    if (sub_count == sub_cap)
+    {
+        uint32_t cap = sub_cap ? sub_cap * 2 : TIME_SUBS_INIT_CAP;
+        time_sub_t *p = lv_realloc(subs, cap * sizeof(time_sub_t));
+        if (!p)
+            return -EOS_ERR_MEM;
+        subs = p;
+        sub_cap = cap;
+    }
+    subs[sub_count++] = (time_sub_t){.unit = unit, .cb = cb, .user_data = user_data};
+    // 新订阅比现有订阅的单位都小时需要重新调度
+    bool was_idle = true;
+    for (uint32_t u = 0; u <= (uint32_t)unit; u++)
+    {
+        if (unit_counts[u])
+            was_idle = false;
+    }
+    unit_counts[unit]++;
+    if (was_idle && !dispatching)
+    {
+        // 唤醒周期变短（或从暂停恢复），按当前时间重新对齐，不更新 last_dt 以免漏掉进位
+        eos_datetime_t dt = eos_time_now();
+        _time_schedule(eos_time_get_us(), &dt);
+    }
+    return EOS_OK;
+}
+
+void eos_time_unsubscribe(eos_time_cb_t cb, void *user_data)
+{
+    for (uint32_t i = 0; i < sub_count; i++)
+    {
+        if (subs[i].cb != cb || subs[i].user_data != user_data)
+            continue;
+        unit_counts[subs[i].unit]--;
+        if (dispatching)
+        {
+            subs[i].cb = NULL;
+            has_removed = true;
+        }
+        else
+        {
+            memmove(&subs[i], &subs[i + 1], (sub_count - i - 1) * sizeof(time_sub_t));
+            sub_count--;
+        }
+        break;
+    }
+    for (uint32_t u = 0; u < EOS_TIME_UNIT_COUNT; u++)
+    {
+        if (unit_counts[u])
+            return;
+    }
+    if (time_timer)
+        lv_timer_pause(time_timer);
+}
@@ -0,0 +1,183 @@
+/**
+ * @file elena_os_trace.c
+ * @brief 性能追踪（导出为 Chrome trace_event JSON，可在 Perfetto 中查看）
+ * @author Sab1e
+ * @date 2025-10-04
+ *
+ * 每个线程第一次记录时从静态池中领取一个环形缓冲区，之后只由该线程写入，
+ * 记录时不加锁、不分配内存。
+ */
+
+#include "elena_os_trace.h"
+
+// Includes
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdatomic.h>
+#include "elena_os_log.h"
+#include "elena_os_port.h"
+// Macros and Definitions
+#ifndef EOS_TRACE_BUFFER_SIZE
+#define EOS_TRACE_BUFFER_SIZE 4096
+#endif /* EOS_TRACE_BUFFER_SIZE */
+#ifndef EOS_TRACE_MAX_THREADS
+#define EOS_TRACE_MAX_THREADS 4
+#endif /* EOS_TRACE_MAX_THREADS */
+#ifdef EOS_USE_TRACE
+/**
+ * @brief 一条记录
+ */
+typedef struct
+{
+    uint64_t ts;            // 时间戳（us）
+    const char *name;
+    uint8_t phase;
+} trace_record_t;
+/**
+ * @brief 线程的环形缓冲区
+ */
+typedef struct
+{
+    atomic_uint_fast32_t write;     // 已写入的记录总数，超过容量后覆盖最旧的记录
+    trace_record_t records[EOS_TRACE_BUFFER_SIZE];
+} trace_ring_t;
+#endif /* EOS_USE_TRACE */
+// Variables
+#ifdef EOS_USE_TRACE
+static trace_ring_t trace_rings[EOS_TRACE_MAX_THREADS];
+static atomic_uint trace_ring_count = 0;
+static atomic_bool trace_enabled = true;
+static _Thread_local trace_ring_t *trace_ring = NULL;
+static _Thread_local bool trace_ring_exhausted = false;
+#endif /* EOS_USE_TRACE */
+// Function Implementations
+#ifdef EOS_USE_TRACE
+/**
+ * @brief 获取当前线程的缓冲区，首次调用时领取
+ */
+static trace_ring_t *_trace_ring_get(void)
+{
+    if (trace_ring || trace_ring_exhausted)
+        return trace_ring;
+    unsigned int idx = atomic_fetch_add(&trace_ring_count, 1);
+    if (idx >= EOS_TRACE_MAX_THREADS)
+    {
+        // 超出线程数量上限，此线程不再记录
+        trace_ring_exhausted = true;
+        return NULL;
+    }
+    trace_ring = &trace_rings[idx];
+    return trace_ring;
+}
+
+/**
+ * @brief 写入 JSON 字符串（转义引号与反斜杠）
+ */
+static void _trace_write_str(FILE *fp, const char *s)
+{
+    fputc('"', fp);
+    for (; s && *s; s++)
+    {
+        if (*s == '"' || *s == '\\')
+            fputc('\\', fp);
+        fputc(*s, fp);
+    }
+    fputc('"', fp);
+}
+#endif /* EOS_USE_TRACE */
+
+void eos_trace_record(const char *name, eos_trace_phase_t phase)
+{
+#ifdef EOS_USE_TRACE
+    if (!atomic_load_explicit(&trace_enabled, memory_order_relaxed))
+        return;
+    trace_ring_t *ring = _trace_ring_get();
+    if (!ring)
+        return;
+    uint_fast32_t pos = atomic_load_explicit(&ring->write, memory_order_relaxed);
+    trace_record_t *rec = &ring->records[pos % EOS_TRACE_BUFFER_SIZE];
+    rec->ts = eos_perf_time_get_us();
+    rec->name = name;
+    rec->phase = (uint8_t)phase;
+    atomic_store_explicit(&ring->write, pos + 1, memory_order_release);
+#else
+    EOS_UNUSED(name);
+    EOS_UNUSED(phase);
+#endif /* EOS_USE_TRACE */
+}
+
+void eos_trace_scope_end(const char **name)
+{
+    eos_trace_record(*name, EOS_TRACE_PHASE_END);
+}
+
+void eos_trace_set_enabled(bool enabled)
+{
+#ifdef EOS_USE_TRACE
+    atomic_store(&trace_enabled, enabled);
+#else
+    EOS_UNUSED(enabled);
+#endif /* EOS_USE_TRACE */
+}
+
+void eos_trace_clear(void)
+{
+#ifdef EOS_USE_TRACE
+    unsigned int count = atomic_load(&trace_ring_count);
+    for (unsigned int i = 0; i < count && i < EOS_TRACE_MAX_THREADS; i++)
+    {
+        atomic_store(&trace_rings[i].write, 0);
+    }
+#endif /* EOS_USE_TRACE */
+}
+
+eos_result_t eos_trace_dump(const char *path)
+{
+#ifdef EOS_USE_TRACE
+    EOS_CHECK_PTR_RETURN_VAL(path, -EOS_ERR_VAR_NULL);
+    FILE *fp = fopen(path, "w");
+    if (!fp)
+    {
+        EOS_LOG_E("Open trace file failed: %s", path);
+        return -EOS_ERR_FILE_ERROR;
+    }
+    static const char phase_str[] = {'B', 'E', 'i'};
+    bool first = true;
+    uint32_t total = 0;
+    fputs("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[", fp);
+    unsigned int count = atomic_load(&trace_ring_count);
+    for (unsigned int t = 0; t < count && t < EOS_TRACE_MAX_THREADS; t++)
+    {
+        trace_ring_t *ring = &trace_rings[t];
+        uint_fast32_t end = atomic_load_explicit(&ring->write, memory_order_acquire);
+        uint_fast32_t start = end > EOS_TRACE_BUFFER_SIZE ? end - EOS_TRACE_BUFFER_SIZE : 0;
+        fprintf(fp, "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"args\":{\"name\":\"thread %u\"}}",
+                first ? "" : ",", t, t);
+        first = false;
+        for (uint_fast32_t i = start; i < end; i++)
+        {
+            const trace_record_t *rec = &ring->records[i % EOS_TRACE_BUFFER_SIZE];
+            fputs(",{\"name\":", fp);
+            _trace_write_str(fp, rec->name);
+            fprintf(fp, ",\"ph\":\"%c\",\"ts\":%llu,\"pid\":1,\"tid\":%u%s}",
+                    phase_str[rec->phase], (unsigned long long)rec->ts, t,
+                    rec->phase == EOS_TRACE_PHASE_INSTANT ? ",\"s\":\"t\"" : "");
+            total++;
+        }
+    }
+    fputs("]}\n", fp);
+    bool ok = (ferror(fp) == 0);
+    fclose(fp);
+    if (!ok)
+    {
+        EOS_LOG_E("Write trace file failed: %s", path);
+        return -EOS_ERR_FILE_ERROR;
+    }
+    EOS_LOG_I("Trace dumped: %s (%u records)", path, total);
+    return EOS_OK;
+#else
+    EOS_UNUSED(path);
+    EOS_LOG_W("Trace disabled, define EOS_USE_TRACE in elena_os_config.h");
+    return -EOS_FAILED;
+#endif /* EOS_USE_TRACE */
+}
@@ -18,9 +18,13 @@
 #include "elena_os_port.h"
 #include "elena_os_log.h"
 #include "elena_os_pkg_mgr.h"
+#include "elena_os_img.h"
+#include "elena_os_watchface_layout.h"
 #include "script_engine_core.h"
+#include "elena_os_boot.h"
 // Macros and Definitions
 #define EOS_WATCHFACE_LIST_DEFAULT_CAPACITY 1
+#define EOS_WATCHFACE_SNAPSHOT_DELAY_MS 1000 // 脚本表盘启动后等待绘制完成的时间
 /**
  * @brief 应用结构体
  */
@@ -35,6 +39,8 @@ typedef struct
 static eos_watchface_list_t watchface_list;
 static bool watchface_list_initialized = false;
 // Variables
+static lv_timer_t *snapshot_timer = NULL;  // 脚本表盘缩略图截取定时器
+static char *snapshot_watchface_id = NULL;
 
 // Function Implementations
 
@@ -147,6 +153,7 @@ eos_result_t _eos_watchface_list_refresh()
 eos_result_t eos_watchface_install(const char *eapk_path)
 {
     EOS_CHECK_PTR_RETURN_VAL(eapk_path, EOS_ERR_VAR_NULL);
+    eos_boot_wait();
     // 获取软件包头
     eos_pkg_header_t header;
     if (eos_pkg_read_header(eapk_path, &header) != EOS_OK)
@@ -208,6 +215,19 @@ eos_result_t eos_watchface_install(const char *eapk_path)
         eos_rm_recursive(path);
         return EOS_FAILED;
     }
+    // 生成表盘列表所需尺寸的预览图：声明式表盘直接离屏渲染，否则缩放安装包中的预览图
+    char thumbnail_path[PATH_MAX];
+    snprintf(thumbnail_path, sizeof(thumbnail_path), "%s/" EOS_WATCHFACE_THUMBNAIL_FILE_NAME, data_path);
+    remove(thumbnail_path);
+    if (eos_watchface_snapshot_generate(header.pkg_id) != EOS_OK)
+    {
+        char snapshot_path[PATH_MAX];
+        snprintf(snapshot_path, sizeof(snapshot_path), "%s/" EOS_WATCHFACE_SNAPSHOT_FILE_NAME, path);
+        if (eos_is_file(snapshot_path))
+        {
+            eos_img_variant_generate(snapshot_path, EOS_IMG_SIZE_WF_SNAPSHOT_W, EOS_IMG_SIZE_WF_SNAPSHOT_H);
+        }
+    }
     _eos_watchface_list_refresh();
     EOS_LOG_D("Watchface installed successfully: %s", header.pkg_name);
     return EOS_OK;
@@ -215,6 +235,7 @@ eos_result_t eos_watchface_install(const char *eapk_path)
 
 eos_result_t eos_watchface_uninstall(const char *watchface_id)
 {
+    eos_boot_wait();
     // 卸载应用程序
     char path[PATH_MAX];
     snprintf(path, sizeof(path), EOS_WATCHFACE_INSTALLED_DIR "%s", watchface_id);
@@ -236,7 +257,7 @@ eos_result_t eos_watchface_uninstall(const char *watchface_id)
 
     // 清理应用数据
     if(eos_is_dir(data_path)){
-        ret = eos_rm_recursive(path);
+        ret = eos_rm_recursive(data_path);
     }
 
     if (ret != EOS_OK)
@@ -249,6 +270,87 @@ eos_result_t eos_watchface_uninstall(const char *watchface_id)
     return EOS_OK;
 }
 
+void eos_watchface_preview_path(char *buf, size_t size, const char *watchface_id)
+{
+    snprintf(buf, size, EOS_WATCHFACE_DATA_DIR "%s/" EOS_WATCHFACE_THUMBNAIL_FILE_NAME, watchface_id);
+    if (eos_is_file(buf))
+        return;
+    snprintf(buf, size, EOS_WATCHFACE_INSTALLED_DIR "%s/" EOS_WATCHFACE_SNAPSHOT_FILE_NAME, watchface_id);
+    if (eos_is_file(buf))
+        return;
+    snprintf(buf, size, "%s", EOS_IMG_APP);
+}
+
+eos_result_t eos_watchface_snapshot_capture(const char *watchface_id, lv_obj_t *obj)
+{
+    EOS_CHECK_PTR_RETURN_VAL(watchface_id && obj, -EOS_ERR_VAR_NULL);
+    char thumbnail_path[PATH_MAX];
+    snprintf(thumbnail_path, sizeof(thumbnail_path), EOS_WATCHFACE_DATA_DIR "%s/" EOS_WATCHFACE_THUMBNAIL_FILE_NAME,
+             watchface_id);
+    eos_result_t ret = eos_img_obj_scale_to_file(obj, thumbnail_path,
+                                                 EOS_IMG_SIZE_WF_SNAPSHOT_W, EOS_IMG_SIZE_WF_SNAPSHOT_H);
+    if (ret == EOS_OK)
+    {
+        EOS_LOG_I("Watchface thumbnail generated: %s", watchface_id);
+    }
+    return ret;
+}
+
+eos_result_t eos_watchface_snapshot_generate(const char *watchface_id)
+{
+    EOS_CHECK_PTR_RETURN_VAL(watchface_id, -EOS_ERR_VAR_NULL);
+    if (!eos_watchface_layout_exists(watchface_id))
+    {
+        // 脚本表盘需要虚拟机，首次运行时再截取
+        return EOS_FAILED;
+    }
+    // 在未加载的屏幕上绘制一帧，不影响当前显示
+    lv_obj_t *scr = lv_obj_create(NULL);
+    eos_result_t ret = EOS_FAILED;
+    if (eos_watchface_layout_create(scr, watchface_id))
+    {
+        ret = eos_watchface_snapshot_capture(watchface_id, scr);
+    }
+    lv_obj_delete(scr);
+    return ret;
+}
+
+static void _snapshot_timer_cb(lv_timer_t *timer)
+{
+    lv_obj_t *scr = (lv_obj_t *)lv_timer_get_user_data(timer);
+    // 表盘被其他页面覆盖时等待下次
+    if (lv_screen_active() != scr)
+        return;
+    eos_watchface_snapshot_capture(snapshot_watchface_id, scr);
+    eos_watchface_snapshot_cancel();
+}
+
+void eos_watchface_snapshot_schedule(const char *watchface_id, lv_obj_t *scr)
+{
+    EOS_CHECK_PTR_RETURN(watchface_id && scr);
+    eos_watchface_snapshot_cancel();
+    char thumbnail_path[PATH_MAX];
+    snprintf(thumbnail_path, sizeof(thumbnail_path), EOS_WATCHFACE_DATA_DIR "%s/" EOS_WATCHFACE_THUMBNAIL_FILE_NAME,
+             watchface_id);
+    if (eos_is_file(thumbnail_path))
+        return;
+    snapshot_watchface_id = lv_strdup(watchface_id);
+    if (!snapshot_watchface_id)
+        return;
+    snapshot_timer = lv_timer_create(_snapshot_timer_cb, EOS_WATCHFACE_SNAPSHOT_DELAY_MS, scr);
+}
+
+void eos_watchface_snapshot_cancel(void)
+{
+    if (snapshot_timer)
+    {
+        lv_timer_delete(snapshot_timer);
+        snapshot_timer = NULL;
+    }
+    lv_free(snapshot_watchface_id);
+    snapshot_watchface_id = NULL;
+}
+
 eos_result_t eos_watchface_init(void)
 {
     // 初始化 从文件系统中读取应用列表
@@ -0,0 +1,118 @@
+/**
+ * @file elena_os_watchface_cache.c
+ * @brief 表盘静态层缓存
+ * @author Sab1e
+ * @date 2025-09-21
+ */
+
+#include "elena_os_watchface_cache.h"
+
+// Includes
+#include <stdio.h>
+#include <stdlib.h>
+#include "lvgl.h"
+#include "elena_os_img.h"
+#include "elena_os_event.h"
+#include "elena_os_log.h"
+// Macros and Definitions
+typedef struct
+{
+    eos_watchface_static_builder_t builder;
+    void *user_data;
+    lv_draw_buf_t *draw_buf; // 静态层像素缓存（eos_malloc_large 分配）
+} static_layer_t;
+// Variables
+
+// Function Implementations
+
+static void _static_layer_render(lv_obj_t *layer_obj, static_layer_t *layer)
+{
+    lv_obj_t *parent = lv_obj_get_parent(layer_obj);
+
+    // 在临时容器中构建静态对象，背景与父对象保持一致，得到不透明的缓存
+    lv_obj_t *cont = lv_obj_create(parent);
+    lv_obj_remove_style_all(cont);
+    lv_obj_set_size(cont,
+                    lv_display_get_horizontal_resolution(lv_obj_get_display(parent)),
+                    lv_display_get_vertical_resolution(lv_obj_get_display(parent)));
+    lv_obj_set_style_bg_opa(cont, LV_OPA_COVER, 0);
+    lv_obj_set_style_bg_color(cont, lv_obj_get_style_bg_color(parent, LV_PART_MAIN), 0);
+    layer->builder(cont, layer->user_data);
+
+    lv_draw_buf_t *draw_buf = eos_img_snapshot_take(cont, LV_COLOR_FORMAT_NATIVE);
+    lv_obj_delete(cont);
+    if (!draw_buf)
+    {
+        EOS_LOG_E("Render static layer failed");
+        return;
+    }
+
+    lv_draw_buf_t *old_buf = layer->draw_buf;
+    layer->draw_buf = draw_buf;
+    lv_image_set_src(layer_obj, draw_buf);
+    if (old_buf)
+        eos_img_snapshot_free(old_buf);
+    EOS_LOG_D("Static layer rendered: %dx%d", (int)draw_buf->header.w, (int)draw_buf->header.h);
+}
+
+static void _static_layer_theme_cb(lv_event_t *e)
+{
+    lv_obj_t *layer_obj = lv_event_get_current_target(e);
+    eos_watchface_static_layer_invalidate(layer_obj);
+}
+
+static void _static_layer_delete_cb(lv_event_t *e)
+{
+    static_layer_t *layer = (static_layer_t *)lv_event_get_user_data(e);
+    EOS_CHECK_PTR_RETURN(layer);
+    if (layer->draw_buf)
+    {
+        lv_image_set_src(lv_event_get_target(e), NULL);
+        eos_img_snapshot_free(layer->draw_buf);
+    }
+    lv_free(layer);
+}
+
+lv_obj_t *eos_watchface_static_layer_create(lv_obj_t *parent,
+                                            eos_watchface_static_builder_t builder,
+                                            void *user_data)
+{
+    EOS_CHECK_PTR_RETURN_VAL(parent, NULL);
+    EOS_CHECK_PTR_RETURN_VAL(builder, NULL);
+
+    static_layer_t *layer = (static_layer_t *)lv_malloc_zeroed(sizeof(static_layer_t));
+    EOS_CHECK_PTR_RETURN_VAL(layer, NULL);
+    layer->builder = builder;
+    layer->user_data = user_data;
+
+    lv_obj_t *layer_obj = lv_image_create(parent);
+    lv_obj_remove_flag(layer_obj, LV_OBJ_FLAG_CLICKABLE);
+    lv_obj_set_pos(layer_obj, 0, 0);
+    lv_obj_add_event_cb(layer_obj, _static_layer_delete_cb, LV_EVENT_DELETE, layer);
+    _static_layer_render(layer_obj, layer);
+    if (!layer->draw_buf)
+    {
+        lv_obj_delete(layer_obj);
+        return NULL;
+    }
+    lv_obj_move_background(layer_obj);
+    eos_event_add_cb(layer_obj, _static_layer_theme_cb, eos_event_get_code(EOS_EVENT_THEME_UPDATED), NULL);
+    return layer_obj;
+}
+
+void eos_watchface_static_layer_invalidate(lv_obj_t *layer)
+{
+    EOS_CHECK_PTR_RETURN(layer);
+    // 通过删除回调的用户数据找到缓存描述
+    uint32_t event_cnt = lv_obj_get_event_count(layer);
+    for (uint32_t i = 0; i < event_cnt; i++)
+    {
+        lv_event_dsc_t *dsc = lv_obj_get_event_dsc(layer, i);
+        if (lv_event_dsc_get_cb(dsc) == _static_layer_delete_cb)
+        {
+            _static_layer_render(layer, (static_layer_t *)lv_event_dsc_get_user_data(dsc));
+            return;
+        }
+    }
+    EOS_LOG_W("Object is not a static layer");
+}
@@ -0,0 +1,543 @@
+/**
+ * @file elena_os_watchface_layout.c
+ * @brief 声明式表盘（无需 JS 虚拟机）
+ * @author Sab1e
+ * @date 2025-09-20
+ */
+
+#include "elena_os_watchface_layout.h"
+
+// Includes
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "lvgl.h"
+#include "cJSON.h"
+#include "elena_os_watchface.h"
+#include "elena_os_watchface_cache.h"
+#include "elena_os_img.h"
+#include "elena_os_misc.h"
+#include "elena_os_port.h"
+#include "elena_os_log.h"
+#include "elena_os_time.h"
+// Macros and Definitions
+#define WF_LAYOUT_GLYPH_COUNT 10
+
+/**
+ * @brief 图层类型
+ */
+typedef enum
+{
+    WF_LAYER_IMAGE = 0,
+    WF_LAYER_DIGITS,
+    WF_LAYER_TEXT,
+} wf_layer_type_t;
+
+/**
+ * @brief 数据绑定
+ */
+typedef enum
+{
+    WF_BIND_NONE = 0,
+    WF_BIND_HOUR,
+    WF_BIND_MINUTE,
+    WF_BIND_SECOND,
+    WF_BIND_YEAR,
+    WF_BIND_MONTH,
+    WF_BIND_DAY,
+    WF_BIND_WEEKDAY,
+    WF_BIND_BATTERY,
+    WF_BIND_STEPS,
+    WF_BIND_HOUR_ANGLE,
+    WF_BIND_MINUTE_ANGLE,
+    WF_BIND_SECOND_ANGLE,
+} wf_bind_t;
+
+typedef struct
+{
+    const char *name;
+    wf_bind_t bind;
+    bool need_second; // 是否需要每秒刷新
+} wf_bind_entry_t;
+
+typedef struct
+{
+    wf_layer_type_t type;
+    wf_bind_t bind;
+    int32_t last_value;                                  // 上次显示的值，用于跳过无变化的刷新
+    lv_obj_t *obj;                                       // 图片 / 标签 / 数字容器
+    lv_obj_t *glyphs[WF_LAYOUT_GLYPH_COUNT];             // 数字字模（隐藏，只加载一次）
+    lv_obj_t *digit_objs[EOS_WATCHFACE_LAYOUT_DIGITS_MAX];
+    uint8_t digit_count;
+    char *format; // 文本格式
+} wf_layer_t;
+
+typedef struct
+{
+    wf_layer_t *layers;
+    uint32_t layer_count;
+    bool need_second;
+    cJSON *static_layers; // 预渲染到静态层缓存的图层描述
+    char *watchface_id;
+} wf_layout_t;
+// Variables
+static const wf_bind_entry_t wf_bind_table[] = {
+    {"hour", WF_BIND_HOUR, false},
+    {"minute", WF_BIND_MINUTE, false},
+    {"second", WF_BIND_SECOND, true},
+    {"year", WF_BIND_YEAR, false},
+    {"month", WF_BIND_MONTH, false},
+    {"day", WF_BIND_DAY, false},
+    {"weekday", WF_BIND_WEEKDAY, false},
+    {"battery", WF_BIND_BATTERY, false},
+    {"steps", WF_BIND_STEPS, false},
+    {"hour_angle", WF_BIND_HOUR_ANGLE, false},
+    {"minute_angle", WF_BIND_MINUTE_ANGLE, false},
+    {"second_angle", WF_BIND_SECOND_ANGLE, true},
+};
+// Function Implementations
+
+static const wf_bind_entry_t *_bind_lookup(const char *name)
+{
+    if (!name)
+        return NULL;
+    for (size_t i = 0; i < sizeof(wf_bind_table) / sizeof(wf_bind_table[0]); i++)
+    {
+        if (strcmp(wf_bind_table[i].name, name) == 0)
+            return &wf_bind_table[i];
+    }
+    return NULL;
+}
+
+static int32_t _bind_get_value(wf_bind_t bind, const eos_datetime_t *dt)
+{
+    switch (bind)
+    {
+    case WF_BIND_HOUR:
+        return dt->hour;
+    case WF_BIND_MINUTE:
+        return dt->min;
+    case WF_BIND_SECOND:
+        return dt->sec;
+    case WF_BIND_YEAR:
+        return dt->year;
+    case WF_BIND_MONTH:
+        return dt->month;
+    case WF_BIND_DAY:
+        return dt->day;
+    case WF_BIND_WEEKDAY:
+        return dt->day_of_week;
+    case WF_BIND_BATTERY:
+        return eos_battery_get_level();
+    case WF_BIND_STEPS:
+        return (int32_t)eos_steps_get();
+    case WF_BIND_HOUR_ANGLE:
+        // 12 小时转一圈，每分钟 0.5 度
+        return (dt->hour % 12) * 300 + dt->min * 5;
+    case WF_BIND_MINUTE_ANGLE:
+        return dt->min * 60;
+    case WF_BIND_SECOND_ANGLE:
+        return dt->sec * 60;
+    default:
+        return 0;
+    }
+}
+
+/**
+ * @brief 只允许一个整数占位符（可带宽度与 0 填充）以及 %%
+ */
+static bool _format_is_valid(const char *fmt)
+{
+    uint8_t conv = 0;
+    for (const char *p = fmt; *p; p++)
+    {
+        if (*p != '%')
+            continue;
+        p++;
+        if (*p == '%')
+            continue;
+        while (*p >= '0' && *p <= '9')
+            p++;
+        if (*p != 'd')
+            return false;
+        conv++;
+    }
+    return conv == 1;
+}
+
+static void _asset_path(char *buf, size_t size, const char *watchface_id, const char *name)
+{
+    snprintf(buf, size, EOS_WATCHFACE_INSTALLED_DIR "%s/assets/%s", watchface_id, name);
+}
+
+static lv_color_t _parse_color(const cJSON *item, lv_color_t def)
+{
+    if (!cJSON_IsString(item) || item->valuestring[0] != '#')
+        return def;
+    return lv_color_hex(strtoul(item->valuestring + 1, NULL, 16));
+}
+
+static int32_t _get_int(const cJSON *obj, const char *key, int32_t def)
+{
+    const cJSON *item = cJSON_GetObjectItemCaseSensitive(obj, key);
+    return cJSON_IsNumber(item) ? (int32_t)item->valueint : def;
+}
+
+static void _layer_place(lv_obj_t *obj, const cJSON *item)
+{
+    int32_t x = _get_int(item, "x", 0);
+    int32_t y = _get_int(item, "y", 0);
+    const cJSON *align = cJSON_GetObjectItemCaseSensitive(item, "align");
+    if (cJSON_IsString(align) && strcmp(align->valuestring, "center") == 0)
+        lv_obj_align(obj, LV_ALIGN_CENTER, x, y);
+    else
+        lv_obj_set_pos(obj, x, y);
+}
+
+static void _layer_update(wf_layer_t *layer, const eos_datetime_t *dt, bool force)
+{
+    if (layer->bind == WF_BIND_NONE)
+        return;
+    int32_t value = _bind_get_value(layer->bind, dt);
+    if (!force && value == layer->last_value)
+        return;
+    layer->last_value = value;
+
+    switch (layer->type)
+    {
+    case WF_LAYER_IMAGE:
+        lv_image_set_rotation(layer->obj, value);
+        break;
+    case WF_LAYER_DIGITS:
+    {
+        uint32_t v = value < 0 ? 0 : (uint32_t)value;
+        for (int8_t i = layer->digit_count - 1; i >= 0; i--)
+        {
+            lv_obj_t *glyph = layer->glyphs[v % 10];
+            lv_image_set_src(layer->digit_objs[i], glyph ? lv_image_get_src(glyph) : NULL);
+            v /= 10;
+        }
+        break;
+    }
+    case WF_LAYER_TEXT:
+    {
+        char buf[EOS_WATCHFACE_LAYOUT_TEXT_MAX];
+        lv_snprintf(buf, sizeof(buf), layer->format, (int)value);
+        lv_label_set_text(layer->obj, buf);
+        break;
+    }
+    default:
+        break;
+    }
+}
+
+static void _layout_refresh(wf_layout_t *layout, const eos_datetime_t *dt, bool force)
+{
+    for (uint32_t i = 0; i < layout->layer_count; i++)
+    {
+        _layer_update(&layout->layers[i], dt, force);
+    }
+}
+
+/**
+ * @brief 时间服务回调，无秒级绑定时只在整分钟触发
+ */
+static void _layout_time_cb(const eos_datetime_t *dt, void *user_data)
+{
+    _layout_refresh((wf_layout_t *)user_data, dt, false);
+}
+
+static void _layout_delete_cb(lv_event_t *e)
+{
+    wf_layout_t *layout = (wf_layout_t *)lv_event_get_user_data(e);
+    if (!layout)
+        return;
+    eos_time_unsubscribe(_layout_time_cb, layout);
+    for (uint32_t i = 0; i < layout->layer_count; i++)
+    {
+        if (layout->layers[i].format)
+            lv_free(layout->layers[i].format);
+    }
+    if (layout->static_layers)
+        cJSON_Delete(layout->static_layers);
+    if (layout->watchface_id)
+        lv_free(layout->watchface_id);
+    lv_free(layout->layers);
+    lv_free(layout);
+}
+
+static bool _layer_create_image(wf_layer_t *layer, lv_obj_t *cont,
+                                const cJSON *item, const char *watchface_id)
+{
+    const cJSON *src = cJSON_GetObjectItemCaseSensitive(item, "src");
+    if (!cJSON_IsString(src))
+    {
+        EOS_LOG_E("Image layer missing src");
+        return false;
+    }
+    char path[PATH_MAX];
+    _asset_path(path, sizeof(path), watchface_id, src->valuestring);
+
+    layer->obj = lv_image_create(cont);
+    eos_img_set_src(layer->obj, path);
+    _layer_place(layer->obj, item);
+    if (cJSON_HasObjectItem(item, "pivot_x") || cJSON_HasObjectItem(item, "pivot_y"))
+    {
+        lv_image_set_pivot(layer->obj, _get_int(item, "pivot_x", 0), _get_int(item, "pivot_y", 0));
+    }
+    return true;
+}
+
+static bool _layer_create_digits(wf_layer_t *layer, lv_obj_t *cont,
+                                 const cJSON *item, const char *watchface_id)
+{
+    const cJSON *font = cJSON_GetObjectItemCaseSensitive(item, "font");
+    if (!cJSON_IsArray(font) || cJSON_GetArraySize(font) != WF_LAYOUT_GLYPH_COUNT)
+    {
+        EOS_LOG_E("Digits layer requires 10 font images");
+        return false;
+    }
+    int32_t digits = _get_int(item, "digits", 2);
+    if (digits <= 0 || digits > EOS_WATCHFACE_LAYOUT_DIGITS_MAX)
+    {
+        EOS_LOG_E("Invalid digit count: %d", (int)digits);
+        return false;
+    }
+    layer->digit_count = (uint8_t)digits;
+
+    layer->obj = lv_obj_create(cont);
+    lv_obj_remove_style_all(layer->obj);
+    lv_obj_set_size(layer->obj, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
+    lv_obj_set_flex_flow(layer->obj, LV_FLEX_FLOW_ROW);
+    lv_obj_set_style_pad_column(layer->obj, _get_int(item, "spacing", 0), 0);
+    lv_obj_remove_flag(layer->obj, LV_OBJ_FLAG_CLICKABLE | LV_OBJ_FLAG_SCROLLABLE);
+    _layer_place(layer->obj, item);
+
+    // 字模只加载一次，数字位直接复用字模的图像描述符
+    for (uint8_t i = 0; i < WF_LAYOUT_GLYPH_COUNT; i++)
+    {
+        const cJSON *name = cJSON_GetArrayItem(font, i);
+        if (!cJSON_IsString(name))
+            continue;
+        char path[PATH_MAX];
+        _asset_path(path, sizeof(path), watchface_id, name->valuestring);
+        layer->glyphs[i] = lv_image_create(cont);
+        lv_obj_add_flag(layer->glyphs[i], LV_OBJ_FLAG_HIDDEN);
+        eos_img_set_src(layer->glyphs[i], path);
+    }
+    for (uint8_t i = 0; i < layer->digit_count; i++)
+    {
+        layer->digit_objs[i] = lv_image_create(layer->obj);
+    }
+    return true;
+}
+
+static bool _layer_create_text(wf_layer_t *layer, lv_obj_t *cont, const cJSON *item)
+{
+    const cJSON *text = cJSON_GetObjectItemCaseSensitive(item, "text");
+    if (layer->bind == WF_BIND_NONE && cJSON_IsString(text))
+    {
+        // 无绑定的固定文本
+        layer->obj = lv_label_create(cont);
+        lv_label_set_text(layer->obj, text->valuestring);
+        lv_obj_set_style_text_color(layer->obj,
+                                    _parse_color(cJSON_GetObjectItemCaseSensitive(item, "color"),
+                                                 lv_color_white()),
+                                    0);
+        _layer_place(layer->obj, item);
+        return true;
+    }
+    const cJSON *format = cJSON_GetObjectItemCaseSensitive(item, "format");
+    const char *fmt = cJSON_IsString(format) ? format->valuestring : "%d";
+    if (!_format_is_valid(fmt))
+    {
+        EOS_LOG_E("Invalid text format: %s", fmt);
+        return false;
+    }
+    layer->format = lv_strdup(fmt);
+    EOS_CHECK_PTR_RETURN_VAL(layer->format, false);
+
+    layer->obj = lv_label_create(cont);
+    lv_label_set_text(layer->obj, "");
+    lv_obj_set_style_text_color(layer->obj,
+                                _parse_color(cJSON_GetObjectItemCaseSensitive(item, "color"),
+                                             lv_color_white()),
+                                0);
+    _layer_place(layer->obj, item);
+    return true;
+}
+
+/**
+ * @brief 判断图层是否可以预渲染到静态层
+ */
+static bool _layer_is_static(const cJSON *item)
+{
+    const cJSON *type = cJSON_GetObjectItemCaseSensitive(item, "type");
+    if (!cJSON_IsString(type) || cJSON_HasObjectItem(item, "bind"))
+        return false;
+    if (strcmp(type->valuestring, "image") == 0)
+        return true;
+    return strcmp(type->valuestring, "text") == 0 && cJSON_HasObjectItem(item, "text");
+}
+
+static void _layout_static_builder(lv_obj_t *cont, void *user_data)
+{
+    wf_layout_t *layout = (wf_layout_t *)user_data;
+    const cJSON *item = NULL;
+    cJSON_ArrayForEach(item, layout->static_layers)
+    {
+        wf_layer_t layer = {0};
+        const cJSON *type = cJSON_GetObjectItemCaseSensitive(item, "type");
+        if (strcmp(type->valuestring, "image") == 0)
+            _layer_create_image(&layer, cont, item, layout->watchface_id);
+        else
+            _layer_create_text(&layer, cont, item);
+    }
+}
+
+bool eos_watchface_layout_exists(const char *watchface_id)
+{
+    EOS_CHECK_PTR_RETURN_VAL(watchface_id, false);
+    char layout_path[PATH_MAX];
+    snprintf(layout_path, sizeof(layout_path), EOS_WATCHFACE_INSTALLED_DIR "%s/" EOS_WATCHFACE_LAYOUT_FILE_NAME,
+             watchface_id);
+    return eos_is_file(layout_path);
+}
+
+lv_obj_t *eos_watchface_layout_create(lv_obj_t *parent, const char *watchface_id)
+{
+    EOS_CHECK_PTR_RETURN_VAL(parent, NULL);
+    EOS_CHECK_PTR_RETURN_VAL(watchface_id, NULL);
+
+    char layout_path[PATH_MAX];
+    snprintf(layout_path, sizeof(layout_path), EOS_WATCHFACE_INSTALLED_DIR "%s/" EOS_WATCHFACE_LAYOUT_FILE_NAME,
+             watchface_id);
+    char *layout_json = eos_read_file(layout_path);
+    if (!layout_json)
+    {
+        EOS_LOG_E("Read layout failed: %s", layout_path);
+        return NULL;
+    }
+    cJSON *root = cJSON_Parse(layout_json);
+    eos_free_large(layout_json);
+    if (!root)
+    {
+        EOS_LOG_E("Layout parse error: %s", cJSON_GetErrorPtr());
+        return NULL;
+    }
+    const cJSON *layers = cJSON_GetObjectItemCaseSensitive(root, "layers");
+    if (!cJSON_IsArray(layers) || cJSON_GetArraySize(layers) == 0)
+    {
+        EOS_LOG_E("Layout has no layers");
+        cJSON_Delete(root);
+        return NULL;
+    }
+
+    wf_layout_t *layout = lv_malloc_zeroed(sizeof(wf_layout_t));
+    if (!layout)
+    {
+        cJSON_Delete(root);
+        return NULL;
+    }
+    layout->layers = lv_malloc_zeroed(sizeof(wf_layer_t) * cJSON_GetArraySize(layers));
+    if (!layout->layers)
+    {
+        lv_free(layout);
+        cJSON_Delete(root);
+        return NULL;
+    }
+
+    lv_obj_t *cont = lv_obj_create(parent);
+    lv_obj_remove_style_all(cont);
+    lv_obj_set_size(cont, lv_pct(100), lv_pct(100));
+    lv_obj_set_style_bg_opa(cont, LV_OPA_COVER, 0);
+    lv_obj_set_style_bg_color(cont,
+                              _parse_color(cJSON_GetObjectItemCaseSensitive(root, "bg_color"),
+                                           lv_color_black()),
+                              0);
+    // 不拦截触摸，长按等手势交由父对象处理
+    lv_obj_remove_flag(cont, LV_OBJ_FLAG_CLICKABLE | LV_OBJ_FLAG_SCROLLABLE);
+    lv_obj_move_background(cont);
+    lv_obj_add_event_cb(cont, _layout_delete_cb, LV_EVENT_DELETE, layout);
+
+    // 位于最底部的连续静态图层只渲染一次，合成为一张缓存图像
+    const cJSON *item = NULL;
+    layout->static_layers = cJSON_CreateArray();
+    layout->watchface_id = lv_strdup(watchface_id);
+    cJSON_ArrayForEach(item, layers)
+    {
+        if (!_layer_is_static(item))
+            break;
+        cJSON_AddItemToArray(layout->static_layers, cJSON_Duplicate(item, true));
+    }
+    int static_count = layout->static_layers ? cJSON_GetArraySize(layout->static_layers) : 0;
+    if (static_count > 0 && layout->watchface_id &&
+        !eos_watchface_static_layer_create(cont, _layout_static_builder, layout))
+    {
+        // 缓存失败时退回为普通对象
+        EOS_LOG_W("Static layer cache unavailable, using live objects");
+        static_count = 0;
+    }
+
+    int index = 0;
+    cJSON_ArrayForEach(item, layers)
+    {
+        if (index++ < static_count)
+            continue;
+        wf_layer_t *layer = &layout->layers[layout->layer_count];
+        const cJSON *type = cJSON_GetObjectItemCaseSensitive(item, "type");
+        if (!cJSON_IsString(type))
+        {
+            EOS_LOG_W("Layer without type skipped");
+            continue;
+        }
+
+        const cJSON *bind = cJSON_GetObjectItemCaseSensitive(item, "bind");
+        const wf_bind_entry_t *entry = _bind_lookup(cJSON_IsString(bind) ? bind->valuestring : NULL);
+        if (cJSON_IsString(bind) && !entry)
+        {
+            EOS_LOG_W("Unknown binding: %s", bind->valuestring);
+        }
+        layer->bind = entry ? entry->bind : WF_BIND_NONE;
+
+        bool ok = false;
+        if (strcmp(type->valuestring, "image") == 0)
+        {
+            layer->type = WF_LAYER_IMAGE;
+            ok = _layer_create_image(layer, cont, item, watchface_id);
+        }
+        else if (strcmp(type->valuestring, "digits") == 0)
+        {
+            layer->type = WF_LAYER_DIGITS;
+            ok = _layer_create_digits(layer, cont, item, watchface_id);
+        }
+        else if (strcmp(type->valuestring, "text") == 0)
+        {
+            layer->type = WF_LAYER_TEXT;
+            ok = _layer_create_text(layer, cont, item);
+        }
+        else
+        {
+            EOS_LOG_W("Unknown layer type: %s", type->valuestring);
+        }
+
+        if (!ok)
+        {
+            if (layer->format)
+                lv_free(layer->format);
+            memset(layer, 0, sizeof(wf_layer_t));
+            continue;
+        }
+        if (entry && entry->need_second)
+            layout->need_second = true;
+        layout->layer_count++;
+    }
+    cJSON_Delete(root);
+
+    eos_datetime_t dt = eos_time_now();
+    _layout_refresh(layout, &dt, true);
+    eos_time_subscribe(layout->need_second ? EOS_TIME_UNIT_SECOND : EOS_TIME_UNIT_MINUTE,
+                       _layout_time_cb, layout);
+    EOS_LOG_D("Watchface layout loaded: %s, layers=%u", watchface_id, (unsigned)layout->layer_count);
+    return cont;
+}
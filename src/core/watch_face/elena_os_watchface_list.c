@@ -27,6 +27,7 @@
 #include "elena_os_anim.h"
 #include "script_engine_core.h"
 #include "elena_os_sys.h"
+#include "elena_os_boot.h"
 
 // Macros and Definitions
 
@@ -51,7 +52,7 @@ void eos_watchface_list_create(void)
 {
     // 创建新的页面用于绘制应用列表
     lv_obj_t *scr = eos_nav_scr_create();
-    lv_screen_load(scr);
+    eos_boot_wait();
     size_t watchface_list_size = eos_watchface_list_size();
 
     lv_obj_t *cont = lv_list_create(scr);
@@ -85,16 +86,11 @@ void eos_watchface_list_create(void)
                               LV_FLEX_ALIGN_CENTER); // 内容居中
 
         char icon_path[PATH_MAX];
-        snprintf(icon_path, sizeof(icon_path), EOS_WATCHFACE_INSTALLED_DIR "%s/" EOS_WATCHFACE_SNAPSHOT_FILE_NAME,
-                 eos_watchface_list_get_id(i));
+        eos_watchface_preview_path(icon_path, sizeof(icon_path), eos_watchface_list_get_id(i));
         EOS_LOG_D("WFPATH:%s", icon_path);
-        if (!eos_is_file(icon_path))
-        {
-            memcpy(icon_path, EOS_IMG_APP, sizeof(EOS_IMG_APP));
-        }
 
         lv_obj_t *watchface_snapshot = lv_image_create(item);
-        lv_obj_set_size(watchface_snapshot, 268, 310);
+        lv_obj_set_size(watchface_snapshot, EOS_IMG_SIZE_WF_SNAPSHOT_W, EOS_IMG_SIZE_WF_SNAPSHOT_H);
         lv_obj_set_style_shadow_width(watchface_snapshot, 0, 0);
         lv_obj_set_style_margin_all(watchface_snapshot, 0, 0);
         lv_obj_center(watchface_snapshot);
@@ -102,8 +98,7 @@ void eos_watchface_list_create(void)
         // lv_obj_remove_flag(watchface_snapshot, LV_OBJ_FLAG_CLICK_FOCUSABLE);
         lv_obj_add_flag(watchface_snapshot, LV_OBJ_FLAG_CLICKABLE);
         lv_obj_add_flag(watchface_snapshot, LV_OBJ_FLAG_CLICK_FOCUSABLE);
-        eos_img_set_src(watchface_snapshot, icon_path);
-        eos_img_set_size(watchface_snapshot, 268, 310);
+        eos_img_set_src_sized_async(watchface_snapshot, icon_path, EOS_IMG_SIZE_WF_SNAPSHOT_W, EOS_IMG_SIZE_WF_SNAPSHOT_H);
         lv_obj_center(watchface_snapshot);
         lv_obj_add_event_cb(watchface_snapshot, _watchface_list_btn_cb, LV_EVENT_CLICKED, (void *)eos_watchface_list_get_id(i));
         lv_obj_set_style_clip_corner(watchface_snapshot, false, 0);
@@ -32,6 +32,98 @@ extern "C" {
 // #define EOS_FONT_USE_C
 // #define EOS_FONT_C_NAME          eos_font_resource_han_rounded_30
 
+/************************** 图片配置 **************************/
+/**
+ * @brief 图片缓存中保留的未引用图片数量（按 LRU 淘汰）
+ */
+#define EOS_IMG_CACHE_RETAIN_COUNT 8
+
+/**
+ * @brief 图片占用堆内存的预算（字节）
+ * @note 超出后先淘汰未引用的缓存，再释放不在显示中的对象的图片（重新显示时自动加载），
+ * 仍超出时广播 EOS_EVENT_LOW_MEMORY
+ */
+#define EOS_IMG_MEM_BUDGET (2 * 1024 * 1024)
+
+/**
+ * @brief 通过 eos_file_mmap 直接映射图片文件，零拷贝使用图片数据
+ * @note 移植层不支持映射时自动回退为读取到内存
+ */
+#define EOS_IMG_USE_MMAP
+
+/**
+ * @brief 加载时将图片转换为显示器的原生格式（RGB565 字节交换、ARGB8888 转 RGB565A8、Alpha 预乘）
+ * @note 转换使用 SSE2 / NEON 加速（无 SIMD 时回退为标量实现），
+ * 需要转换的映射图片会复制到堆中，建议打包时直接使用原生格式
+ */
+#define EOS_IMG_CONVERT
+
+/************************** 导航配置 **************************/
+/**
+ * @brief 返回后保留以便复用的页面数量（按 LRU 淘汰）
+ * @note 仅对通过 eos_nav_scr_create_keyed 创建的页面生效
+ */
+#define EOS_NAV_KEEP_ALIVE_COUNT 3
+
+/************************** 事件配置 **************************/
+/**
+ * @brief eos_event_post 队列长度
+ * @note 队列满时先派发已排队的事件
+ */
+#define EOS_EVENT_QUEUE_SIZE 16
+
+/**
+ * @brief eos_event_post_from_thread 队列长度（必须为 2 的幂）
+ * @note 每个槽位占用约 48 字节，队列满时投递失败
+ */
+#define EOS_EVENT_THREAD_QUEUE_SIZE 64
+
+/************************** 空闲配置 **************************/
+/**
+ * @brief 主循环单次空闲等待的最长时间（ms）
+ */
+#define EOS_IDLE_MAX_SLEEP_MS 5000
+
+/**
+ * @brief 输入驱动在有输入时调用 eos_idle_wakeup
+ * @note 开启后无操作超过 EOS_IDLE_INPUT_POLL_MS 时暂停输入设备的轮询，
+ * 驱动未调用 eos_idle_wakeup 时开启将无法响应输入
+ */
+// #define EOS_IDLE_INPUT_WAKEUP
+
+/**
+ * @brief 无操作多久后暂停输入设备的轮询（ms）
+ */
+#define EOS_IDLE_INPUT_POLL_MS 500
+
+/************************** 调试配置 **************************/
+/**
+ * @brief 性能追踪（EOS_TRACE_* 宏），关闭时宏编译为空
+ * @note 使用 eos_trace_dump 导出 Chrome trace_event JSON，在 https://ui.perfetto.dev 中打开
+ */
+// #define EOS_USE_TRACE
+
+/**
+ * @brief 每个线程的追踪缓冲区可保存的记录数（每条 24 字节）
+ */
+#define EOS_TRACE_BUFFER_SIZE 4096
+
+/**
+ * @brief 可记录追踪的最大线程数量
+ */
+#define EOS_TRACE_MAX_THREADS 4
+
+/**
+ * @brief 启动时显示 FPS / CPU 浮层
+ * @note 也可通过 eos_frame_stats_overlay_set 在运行时切换
+ */
+// #define EOS_FRAME_STATS_OVERLAY
+
+/**
+ * @brief 帧耗时直方图的桶宽（us），共 64 个桶
+ */
+#define EOS_FRAME_STATS_BUCKET_US 1000
+
 /************************** 配置结束 **************************/
 
 #ifdef __cplusplus
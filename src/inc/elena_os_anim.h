@@ -26,6 +26,19 @@ typedef enum{
     EOS_ANIM_SCALE,
     // 此处可以添加其他动画类型
 }eos_anim;
+/**
+ * @brief 页面切换动画类型
+ */
+typedef enum{
+    EOS_ANIM_SCR_LOAD_NONE,
+    EOS_ANIM_SCR_LOAD_OVER_LEFT,    /**< 新页面从右侧覆盖旧页面 */
+    EOS_ANIM_SCR_LOAD_OVER_RIGHT,   /**< 新页面从左侧覆盖旧页面 */
+    EOS_ANIM_SCR_LOAD_MOVE_LEFT,    /**< 新旧页面一起向左移动 */
+    EOS_ANIM_SCR_LOAD_MOVE_RIGHT,   /**< 新旧页面一起向右移动 */
+    EOS_ANIM_SCR_LOAD_OUT_LEFT,     /**< 旧页面向左移出，露出新页面 */
+    EOS_ANIM_SCR_LOAD_OUT_RIGHT,    /**< 旧页面向右移出，露出新页面 */
+    EOS_ANIM_SCR_LOAD_FADE_OUT,     /**< 旧页面淡出，露出新页面 */
+}eos_anim_scr_load_t;
 typedef struct eos_anim_t eos_anim_t;   // 预定义
 /**
  * @brief 回调函数的类型定义
@@ -98,6 +111,16 @@ void* eos_anim_get_user_data(eos_anim_t *anim);
  * @note 如果动画正在运行会自动停止
  */
 void eos_anim_del(eos_anim_t* anim);
+/**
+ * @brief 使用快照动画加载页面
+ * @param new_scr 要加载的页面
+ * @param type 动画类型
+ * @param duration 持续时间(ms)
+ * @param auto_del 是否删除旧页面
+ * @note 旧页面只渲染一次为图像，动画期间仅新页面实时绘制；
+ * 新页面立即成为活动屏幕，调用后无需等待动画结束。快照失败时回退为 lv_screen_load_anim
+ */
+void eos_anim_scr_load(lv_obj_t *new_scr, eos_anim_scr_load_t type, uint32_t duration, bool auto_del);
 /**
  * @brief 添加透明阻碍层，禁止用户输入
  */
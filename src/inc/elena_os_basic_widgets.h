@@ -29,7 +29,6 @@ typedef struct{
     lv_obj_t *clock_label;
     lv_obj_t *title_label;
     lv_obj_t *back_btn;
-    lv_timer_t *clock_timer;
 }eos_app_header_t;
 /**
  * @brief 列表内的滑块定义
@@ -89,6 +88,14 @@ void eos_app_header_init(void);
  * @param title 主题（一般是应用名称），可以通过`eos_app_header_set_title`进行修改
  */
 void eos_screen_bind_header(lv_obj_t *scr, const char *title);
+/**
+ * @brief 仅在文字变化时设置标签文字，避免无意义的重绘
+ * @param label 目标标签
+ * @param text 新文字
+ * @return true 文字已更新
+ * @return false 文字未变化
+ */
+bool eos_label_set_text_if_changed(lv_obj_t *label, const char *text);
 /**
  * @brief 向列表中添加指定像素高度的占位符
  * @param list 目标列表
@@ -0,0 +1,76 @@
+/**
+ * @file elena_os_boot.h
+ * @brief 启动阶段计时与后台初始化
+ * @author Sab1e
+ * @date 2025-10-07
+ */
+
+#ifndef ELENA_OS_BOOT_H
+#define ELENA_OS_BOOT_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ---------------------------------------------------*/
+#include <stdint.h>
+#include <stdbool.h>
+
+/* Public macros ----------------------------------------------*/
+/**
+ * @brief 计时执行一个启动阶段，结果输出到日志与性能追踪
+ * @param name 阶段名称（字符串常量）
+ * @param stmt 阶段内执行的语句
+ */
+#define EOS_BOOT_PHASE(name, stmt)                          \
+    do                                                      \
+    {                                                       \
+        uint64_t _eos_boot_t0 = eos_boot_phase_begin(name); \
+        stmt;                                               \
+        eos_boot_phase_end(name, _eos_boot_t0);             \
+    } while (0)
+
+/* Public typedefs --------------------------------------------*/
+
+/* Public function prototypes --------------------------------*/
+/**
+ * @brief 开始计时启动过程，并在首帧渲染完成时输出各阶段耗时
+ * @note 需在显示器创建后、其他初始化前调用
+ */
+void eos_boot_init(void);
+/**
+ * @brief 开始一个启动阶段
+ * @param name 阶段名称（字符串常量）
+ * @return uint64_t 开始时间，传给 eos_boot_phase_end
+ */
+uint64_t eos_boot_phase_begin(const char *name);
+/**
+ * @brief 结束一个启动阶段
+ * @param name 阶段名称，与 eos_boot_phase_begin 相同
+ * @param start_us eos_boot_phase_begin 的返回值
+ */
+void eos_boot_phase_end(const char *name, uint64_t start_us);
+/**
+ * @brief 在后台线程中执行不依赖 LVGL 的初始化（应用列表、应用顺序、表盘列表）
+ * @note 需在 eos_sys_init 之后调用（依赖系统目录），线程创建失败时在当前线程执行
+ */
+void eos_boot_worker_start(void);
+/**
+ * @brief 等待后台初始化完成
+ * @note 访问应用列表 / 表盘列表前调用，已完成时立即返回
+ */
+void eos_boot_wait(void);
+/**
+ * @brief 后台初始化是否已完成
+ */
+bool eos_boot_is_done(void);
+/**
+ * @brief 获取从 eos_boot_init 到首帧渲染完成的时间
+ * @return uint32_t 耗时（us），首帧未完成时返回 0
+ */
+uint32_t eos_boot_first_frame_us(void);
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ELENA_OS_BOOT_H */
@@ -16,6 +16,7 @@ extern "C" {
 #include <stdint.h>
 #include <stdbool.h>
 #include "lvgl.h"
+#include "elena_os_mpsc.h"
 /* Public macros ----------------------------------------------*/
 
 /* Public typedefs --------------------------------------------*/
@@ -29,9 +30,14 @@ typedef enum{
     EOS_EVENT_THEME_UPDATED,
     EOS_EVENT_APP_DELETED,
     EOS_EVENT_APP_INSTALLED,
+    EOS_EVENT_LOW_MEMORY,           // 内存紧张，各模块应释放可重建的缓存
     /* 此处添加新的事件 */
     EOS_EVENT_MAX_NUMBER
 } eos_event_t;
+/**
+ * @brief 在 UI 线程中执行的回调
+ */
+typedef void (*eos_thread_call_cb_t)(void *user_data);
 /* Public function prototypes --------------------------------*/
 
 /**
@@ -77,8 +83,49 @@ void eos_event_remove_cb(lv_obj_t *obj, lv_event_code_t event, lv_event_cb_t cb)
  * @brief 广播事件
  * @param event 要广播的事件类型
  * @param param 事件参数
+ * @note 在调用处同步派发，回调返回后才继续执行
  */
 void eos_event_broadcast(lv_event_code_t event, void *param);
+
+/**
+ * @brief 投递事件，在下一次 lv_timer_handler 中统一广播
+ * @param event 要广播的事件类型
+ * @param param 事件参数，派发前必须保持有效
+ * @note 同一帧内事件码与参数相同的事件只派发一次（按最后一次投递的顺序）
+ */
+void eos_event_post(lv_event_code_t event, void *param);
+
+/**
+ * @brief 立即派发所有已投递的事件
+ */
+void eos_event_flush(void);
+
+/**
+ * @brief 从其他线程（驱动、传感器等）投递事件，不加锁、不分配内存
+ * @param event 要广播的事件类型
+ * @param data 事件数据，会被复制（可为 NULL）
+ * @param size 数据长度，不超过 EOS_MPSC_PAYLOAD_SIZE
+ * @return eos_result_t 队列已满或未初始化时返回 -EOS_ERR_BUSY，数据超过 EOS_MPSC_PAYLOAD_SIZE 时返回 -EOS_ERR_MEM
+ * @note 事件在主循环调用 eos_event_dispatch_thread 时广播，
+ * 回调中 `lv_event_get_param(e)` 为 `eos_mpsc_msg_t *`，仅在回调期间有效。
+ * 必须在 eos_event_init 之后调用
+ */
+eos_result_t eos_event_post_from_thread(lv_event_code_t event, const void *data, size_t size);
+
+/**
+ * @brief 从其他线程请求在 UI 线程中执行回调，不加锁、不分配内存
+ * @param cb 回调函数
+ * @param user_data 用户数据
+ * @return eos_result_t 同 eos_event_post_from_thread
+ * @note 回调在主循环调用 eos_event_dispatch_thread 时执行，可调用 LVGL
+ */
+eos_result_t eos_event_call_from_thread(eos_thread_call_cb_t cb, void *user_data);
+
+/**
+ * @brief 在 UI 线程广播其他线程投递的事件
+ * @note 每次最多处理一个队列长度的事件，避免生产者持续写入时阻塞主循环
+ */
+void eos_event_dispatch_thread(void);
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,77 @@
+/**
+ * @file elena_os_frame_stats.h
+ * @brief 帧耗时统计与 FPS / CPU 浮层
+ * @author Sab1e
+ * @date 2025-10-05
+ */
+
+#ifndef ELENA_OS_FRAME_STATS_H
+#define ELENA_OS_FRAME_STATS_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ---------------------------------------------------*/
+#include <stdint.h>
+#include <stdbool.h>
+
+/* Public macros ----------------------------------------------*/
+
+/* Public typedefs --------------------------------------------*/
+/**
+ * @brief 单项耗时的分位数（单位 us，精度为直方图的桶宽）
+ */
+typedef struct
+{
+    uint32_t p50;
+    uint32_t p95;
+    uint32_t p99;
+    uint32_t max;
+} eos_frame_stats_dist_t;
+/**
+ * @brief 帧统计结果
+ */
+typedef struct
+{
+    uint32_t fps;                   // 最近一秒渲染的帧数
+    uint8_t cpu;                    // 最近一秒主循环忙碌时间占比（0~100）
+    uint32_t frames;                // 自上次重置以来渲染的帧数
+    eos_frame_stats_dist_t render;  // 单帧渲染耗时
+    eos_frame_stats_dist_t handler; // 每次 lv_timer_handler 耗时
+    eos_frame_stats_dist_t idle;    // 每次循环的空闲（eos_delay）耗时
+} eos_frame_stats_t;
+
+/* Public function prototypes --------------------------------*/
+/**
+ * @brief 初始化帧统计，监听默认显示器的渲染开始 / 结束事件
+ */
+void eos_frame_stats_init(void);
+/**
+ * @brief 记录一次主循环
+ * @param handler_us lv_timer_handler 耗时
+ * @param idle_us 空闲耗时
+ */
+void eos_frame_stats_loop_record(uint32_t handler_us, uint32_t idle_us);
+/**
+ * @brief 获取统计结果
+ * @param stats 输出：统计结果
+ */
+void eos_frame_stats_get(eos_frame_stats_t *stats);
+/**
+ * @brief 清空直方图
+ */
+void eos_frame_stats_reset(void);
+/**
+ * @brief 显示或隐藏 FPS / CPU 浮层（位于 lv_layer_top）
+ */
+void eos_frame_stats_overlay_set(bool show);
+/**
+ * @brief 浮层是否正在显示
+ */
+bool eos_frame_stats_overlay_is_shown(void);
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ELENA_OS_FRAME_STATS_H */
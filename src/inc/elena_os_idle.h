@@ -0,0 +1,44 @@
+/**
+ * @file elena_os_idle.h
+ * @brief 主循环空闲管理（休眠到下一个定时器到期，输入与驱动事件可提前唤醒）
+ * @author Sab1e
+ * @date 2025-10-08
+ */
+
+#ifndef ELENA_OS_IDLE_H
+#define ELENA_OS_IDLE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ---------------------------------------------------*/
+#include <stdint.h>
+#include <stdbool.h>
+
+/* Public macros ----------------------------------------------*/
+
+/* Public typedefs --------------------------------------------*/
+
+/* Public function prototypes --------------------------------*/
+/**
+ * @brief 空闲等待到下一个定时器到期
+ * @param next_ms lv_timer_handler 的返回值（距离下一个 LVGL 定时器的时间）
+ * @note 表头时钟、表盘布局与脚本创建的定时器均为 LVGL 定时器，由 next_ms 统一计算。
+ * 等待通过 eos_idle_wait 实现，期间调用 eos_idle_wakeup 可提前返回
+ */
+void eos_idle_sleep(uint32_t next_ms);
+/**
+ * @brief 恢复被暂停的输入设备轮询
+ * @note 将主循环交给脚本等其他循环前调用，未开启 EOS_IDLE_INPUT_WAKEUP 时为空操作
+ */
+void eos_idle_input_resume(void);
+/**
+ * @brief 获取最近一秒主循环的唤醒次数
+ */
+uint32_t eos_idle_wakeups_per_sec(void);
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ELENA_OS_IDLE_H */
@@ -22,17 +22,13 @@ extern "C" {
 #define EOS_IMG_APP EOS_SYS_RES_IMG_DIR "app.bin"
 #define EOS_IMG_SETTINGS EOS_SYS_RES_IMG_DIR "settings.bin"
 #define EOS_IMG_APP_HEADER_BG EOS_SYS_RES_IMG_DIR "app_header.bin"
+/************************** 系统界面使用的图片尺寸 **************************/
+#define EOS_IMG_SIZE_APP_ICON 100       // 应用列表图标
+#define EOS_IMG_SIZE_LIST_ICON 64       // 列表、消息中的图标
+#define EOS_IMG_SIZE_WF_SNAPSHOT_W 268  // 表盘列表预览图宽度
+#define EOS_IMG_SIZE_WF_SNAPSHOT_H 310  // 表盘列表预览图高度
 /* Public typedefs --------------------------------------------*/
 
-/**
- * @brief 用户数据结构体
- * 
- * 用于清理内存和动态分配的 img
- */
-typedef struct {
-    void *bin_data;             // 指向存储 bin 文件数据的指针
-    lv_image_dsc_t *img_dsc;    // 指向图片描述符的指针
-} img_user_data_t;
 /* Public function prototypes --------------------------------*/
 
 /**
@@ -40,16 +36,110 @@ typedef struct {
  * @param img_obj 目标图像对象
  * @param w 目标宽度（px）
  * @param h 目标高度（px）
+ * @note 只缩放已设置的图像源；需要使用预缩放变体时改用 eos_img_set_src_sized
  */
 void eos_img_set_size(lv_obj_t *img_obj, const uint32_t w, const uint32_t h);
 /**
  * @brief 从 Flash 中打开图片，并加载到内存，然后设置 lvgl 图像源。
  * @param img_obj 要设置图像源的 Image 对象
  * @param bin_path bin 文件的路径
- * @warning 只支持 LVGL 的 bin 文件
- * @note 当 lv_img_t 的对象删除时，自动释放内存
+ * @warning 只支持 LVGL 的 bin 文件（包括 RLE / LZ4 压缩格式，需启用 LV_USE_RLE / LV_USE_LZ4，
+ * 压缩图片解码后存放在 LVGL 图片缓存中，LV_CACHE_DEF_SIZE 不能为 0）
+ * @note 相同路径且未修改的图片在多个对象间共享同一份内存（引用计数），
+ * 当 lv_img_t 的对象删除时释放引用，最近释放的图片按 LRU 保留以便复用
  */
 void eos_img_set_src(lv_obj_t *img_obj, const char *bin_path);
+/**
+ * @brief 异步设置图像源：立即显示占位符，由加载线程读取文件后再替换
+ * @param img_obj 要设置图像源的 Image 对象
+ * @param bin_path bin 文件的路径
+ * @note 已缓存的图片直接设置；加载完成前删除对象或再次设置图像源会自动取消请求；
+ * 加载期间调用 eos_img_set_size 会记录目标尺寸并在加载完成后生效
+ */
+void eos_img_set_src_async(lv_obj_t *img_obj, const char *bin_path);
+/**
+ * @brief 设置图像源并缩放到指定分辨率
+ * @param img_obj 要设置图像源的 Image 对象
+ * @param bin_path bin 文件的路径
+ * @param w 目标宽度（px）
+ * @param h 目标高度（px）
+ * @note 存在 `名称_宽x高.bin` 预缩放变体时只加载变体，原图不会被读取，也避免每帧变换绘制
+ */
+void eos_img_set_src_sized(lv_obj_t *img_obj, const char *bin_path, const uint32_t w, const uint32_t h);
+/**
+ * @brief eos_img_set_src_sized 的异步版本，加载线程只读取选中的文件
+ * @note 加载行为与 eos_img_set_src_async 相同
+ */
+void eos_img_set_src_sized_async(lv_obj_t *img_obj, const char *bin_path, const uint32_t w, const uint32_t h);
+/**
+ * @brief 等待所有异步加载任务完成，并立即将结果设置到等待的对象上
+ * @return true 有未完成的任务（已处理）
+ * @return false 没有未完成的任务
+ * @note 只能在 LVGL 线程调用。模拟器在推进模拟时间前调用，使加载结果在回放中出现的时刻固定
+ */
+bool eos_img_async_flush(void);
+/**
+ * @brief 将对象渲染到绘制缓冲区
+ * @param obj 要渲染的对象（包含其子对象）
+ * @param cf 目标颜色格式，例如 LV_COLOR_FORMAT_NATIVE
+ * @return lv_draw_buf_t* 绘制缓冲区，可直接作为图像源使用；失败返回 NULL
+ * @note 像素数据通过 eos_malloc_large 分配，需使用 eos_img_snapshot_free 释放
+ */
+lv_draw_buf_t *eos_img_snapshot_take(lv_obj_t *obj, lv_color_format_t cf);
+/**
+ * @brief 释放 eos_img_snapshot_take 生成的绘制缓冲区
+ * @param draw_buf 绘制缓冲区
+ */
+void eos_img_snapshot_free(lv_draw_buf_t *draw_buf);
+/**
+ * @brief 将绘制缓冲区保存为 LVGL bin 图片文件
+ * @param draw_buf 绘制缓冲区
+ * @param path 目标文件路径（先写入临时文件再替换）
+ * @return eos_result_t 保存结果
+ */
+eos_result_t eos_img_draw_buf_save(const lv_draw_buf_t *draw_buf, const char *path);
+/**
+ * @brief 将图片缩放到指定尺寸并保存为新的 bin 文件
+ * @param src_path 源图片路径
+ * @param dst_path 目标图片路径
+ * @param w 目标宽度（px）
+ * @param h 目标高度（px）
+ * @return eos_result_t 结果
+ * @note 使用 LVGL 渲染完成缩放，带透明通道的图片保存为 ARGB8888，否则为原生格式
+ */
+eos_result_t eos_img_scale_to_file(const char *src_path, const char *dst_path, uint32_t w, uint32_t h);
+/**
+ * @brief 渲染对象并缩放到指定尺寸，保存为原生格式的 bin 文件
+ * @param obj 要渲染的对象（可以是未加载的屏幕）
+ * @param dst_path 目标图片路径
+ * @param w 目标宽度（px）
+ * @param h 目标高度（px）
+ * @return eos_result_t 结果
+ */
+eos_result_t eos_img_obj_scale_to_file(lv_obj_t *obj, const char *dst_path, uint32_t w, uint32_t h);
+/**
+ * @brief 获取图片预缩放变体的路径，例如 icon.bin -> icon_100x100.bin
+ * @param buf 输出缓冲区
+ * @param size 缓冲区大小
+ * @param src_path 源图片路径
+ * @param w 宽度（px）
+ * @param h 高度（px）
+ */
+void eos_img_variant_path(char *buf, size_t size, const char *src_path, uint32_t w, uint32_t h);
+/**
+ * @brief 生成图片的预缩放变体
+ * @param src_path 源图片路径
+ * @param w 宽度（px）
+ * @param h 高度（px）
+ * @return eos_result_t 结果
+ * @note 变体已存在且不旧于源图片，或源图片已是目标尺寸时直接返回 EOS_OK
+ */
+eos_result_t eos_img_variant_generate(const char *src_path, uint32_t w, uint32_t h);
+/**
+ * @brief 获取图片当前占用的堆内存（映射的图片不计入）
+ * @return size_t 字节数
+ */
+size_t eos_img_mem_used(void);
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,67 @@
+/**
+ * @file elena_os_img_conv.h
+ * @brief 图片像素格式转换（SSE2 / NEON / 标量）
+ * @author Sab1e
+ * @date 2025-09-28
+ */
+
+#ifndef ELENA_OS_IMG_CONV_H
+#define ELENA_OS_IMG_CONV_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ---------------------------------------------------*/
+#include <stdint.h>
+#include <stdbool.h>
+
+/* Public macros ----------------------------------------------*/
+
+/* Public typedefs --------------------------------------------*/
+
+/* Public function prototypes --------------------------------*/
+/**
+ * @brief 获取当前使用的转换实现
+ * @return const char* "SSE2"、"NEON" 或 "scalar"
+ */
+const char *eos_img_conv_backend(void);
+/**
+ * @brief 启用或禁用 SIMD 实现（用于性能对比与结果校验）
+ * @param enable false 时强制使用标量实现
+ */
+void eos_img_conv_set_simd(bool enable);
+/**
+ * @brief RGB565 字节交换（大端 <-> 小端）
+ * @param src 源像素
+ * @param dst 目标像素，可与 src 相同
+ * @param count 像素数量
+ */
+void eos_img_conv_rgb565_swap(const uint16_t *src, uint16_t *dst, uint32_t count);
+/**
+ * @brief ARGB8888 预乘 Alpha
+ * @param src 源像素（内存顺序 B、G、R、A）
+ * @param dst 目标像素，可与 src 相同
+ * @param count 像素数量
+ */
+void eos_img_conv_argb8888_premultiply(const uint8_t *src, uint8_t *dst, uint32_t count);
+/**
+ * @brief ARGB8888 转换为 RGB565A8（颜色与 Alpha 分别写入两个平面）
+ * @param src 源像素（内存顺序 B、G、R、A）
+ * @param dst_rgb 目标 RGB565 像素
+ * @param dst_a 目标 Alpha
+ * @param count 像素数量
+ */
+void eos_img_conv_argb8888_to_rgb565a8(const uint8_t *src, uint16_t *dst_rgb, uint8_t *dst_a, uint32_t count);
+/**
+ * @brief 对比 SIMD 与标量实现的转换耗时，并校验两者结果一致
+ * @param pixels 测试像素数量
+ * @param rounds 每种转换的重复次数
+ * @note 结果通过日志输出
+ */
+void eos_img_conv_benchmark(uint32_t pixels, uint32_t rounds);
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ELENA_OS_IMG_CONV_H */
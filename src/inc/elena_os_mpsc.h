@@ -0,0 +1,85 @@
+/**
+ * @file elena_os_mpsc.h
+ * @brief 无锁多生产者单消费者环形队列
+ * @author Sab1e
+ * @date 2025-10-02
+ */
+
+#ifndef ELENA_OS_MPSC_H
+#define ELENA_OS_MPSC_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ---------------------------------------------------*/
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdatomic.h>
+#include "elena_os_core.h"
+
+/* Public macros ----------------------------------------------*/
+#define EOS_MPSC_PAYLOAD_SIZE 32    // 每条消息携带的最大数据长度（字节）
+#define EOS_MPSC_CACHE_LINE 64
+
+/* Public typedefs --------------------------------------------*/
+/**
+ * @brief 队列消息
+ */
+typedef struct
+{
+    uint32_t code;                          // 消息类型（投递到事件系统时为事件码）
+    uint32_t size;                          // data 中有效数据的长度
+    uint8_t data[EOS_MPSC_PAYLOAD_SIZE];
+} eos_mpsc_msg_t;
+/**
+ * @brief 队列槽位，由调用者提供存储
+ */
+typedef struct
+{
+    atomic_size_t seq;
+    eos_mpsc_msg_t msg;
+} eos_mpsc_slot_t;
+/**
+ * @brief 队列（生产者与消费者的位置分别位于不同的缓存行）
+ */
+typedef struct
+{
+    eos_mpsc_slot_t *slots;
+    size_t mask;
+    _Alignas(EOS_MPSC_CACHE_LINE) atomic_size_t head;  // 生产者竞争的写入位置
+    _Alignas(EOS_MPSC_CACHE_LINE) size_t tail;         // 仅消费者访问的读取位置
+} eos_mpsc_t;
+/* Public function prototypes --------------------------------*/
+/**
+ * @brief 初始化队列
+ * @param q 队列
+ * @param slots 槽位数组
+ * @param capacity 槽位数量，必须为 2 的幂
+ * @note 必须在任何生产者开始写入前调用
+ */
+eos_result_t eos_mpsc_init(eos_mpsc_t *q, eos_mpsc_slot_t *slots, size_t capacity);
+/**
+ * @brief 写入一条消息，可在任意线程调用，不分配内存、不加锁
+ * @param q 队列
+ * @param code 消息类型
+ * @param data 数据（可为 NULL）
+ * @param size 数据长度，不超过 EOS_MPSC_PAYLOAD_SIZE
+ * @return true 写入成功
+ * @return false 队列已满、未初始化或数据过长
+ */
+bool eos_mpsc_push(eos_mpsc_t *q, uint32_t code, const void *data, size_t size);
+/**
+ * @brief 取出一条消息，只能在消费者线程调用
+ * @param q 队列
+ * @param msg 输出：消息
+ * @return true 取出成功
+ * @return false 队列为空
+ */
+bool eos_mpsc_pop(eos_mpsc_t *q, eos_mpsc_msg_t *msg);
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ELENA_OS_MPSC_H */
@@ -17,9 +17,18 @@ extern "C" {
 #include <stdbool.h>
 #include "lvgl.h"
 #include "elena_os_core.h"
+#include "elena_os_anim.h"
 /* Public macros ----------------------------------------------*/
 
 /* Public typedefs --------------------------------------------*/
+/**
+ * @brief 页面所属者，系统页面与脚本页面共用同一个导航栈
+ */
+typedef enum
+{
+    EOS_NAV_OWNER_SYS = 0,
+    EOS_NAV_OWNER_SCRIPT,
+} eos_nav_owner_t;
 
 /* Public function prototypes --------------------------------*/
 
@@ -29,24 +38,70 @@ extern "C" {
  * @note 此 scr 将会放在栈底，作为根页面（root screen），设置后无法修改。
  */
 eos_result_t eos_nav_init(lv_obj_t *scr);
+/**
+ * @brief 判断导航栈是否已经初始化
+ */
+bool eos_nav_is_initialized(void);
 /**
  * @brief 创建新页面并压入导航栈
  * @return lv_obj_t* 创建成功则返回 scr 指针，失败则返回 NULL
  */
 lv_obj_t *eos_nav_scr_create(void);
+/**
+ * @brief 将已创建的页面压入导航栈
+ * @param scr 页面对象
+ * @param owner 页面所属者
+ * @param anim 加载页面时使用的动画
+ * @param duration 动画时长（ms）
+ * @note 栈内容立即更新，页面加载延迟到下一帧，同一帧内的多次操作只加载最终的栈顶页面
+ */
+eos_result_t eos_nav_push(lv_obj_t *scr, eos_nav_owner_t owner, eos_anim_scr_load_t anim, uint32_t duration);
+/**
+ * @brief 获取栈顶页面（尚未加载时与 lv_screen_active 不同）
+ * @return lv_obj_t* 栈顶页面，未初始化返回 NULL
+ */
+lv_obj_t *eos_nav_top(void);
+/**
+ * @brief 获取导航操作的提交次数
+ * @note 两次调用返回值相同，说明期间没有页面被加载，可用于判断对象是否创建于上次提交之后
+ */
+uint32_t eos_nav_commit_seq(void);
+/**
+ * @brief 按 key 创建页面并压入导航栈，返回时页面保留在缓存中，再次进入时直接复用
+ * @param key 页面构建者的唯一标识，例如 "sys.settings"
+ * @param reused 输出：是否复用了缓存的页面（可为 NULL）
+ * @return lv_obj_t* 页面对象，失败则返回 NULL
+ * @note 复用时页面内容保持上次的状态，调用者只需加载页面，无需重新构建。
+ * 缓存数量由 EOS_NAV_KEEP_ALIVE_COUNT 限制，内存紧张、主题或语言变化时全部释放
+ */
+lv_obj_t *eos_nav_scr_create_keyed(const char *key, bool *reused);
+/**
+ * @brief 删除所有缓存的页面
+ */
+void eos_nav_keep_alive_clear(void);
 /**
  * @brief 清理栈内除 root screen 的所有页面
  */
 eos_result_t eos_nav_clear_stack(void);
 /**
- * @brief 返回上一页面并立即销毁 screen 对象
+ * @brief 从栈顶开始清理属于 owner 的连续页面
+ */
+eos_result_t eos_nav_clear_owner(eos_nav_owner_t owner);
+/**
+ * @brief 返回上一页面并销毁 screen 对象
+ * @note 页面在下一帧加载上一页面后删除，因此可以在页面自身的事件回调中调用
  */
 eos_result_t eos_nav_back_clean(void);
 /**
  * @brief 仅返回上一级，不销毁 screen 对象
  * @warning 在不需要 screen 时，需要手动调用`lv_obj_del`清除 screen，否则可能导致内存泄漏。
+ * @note 由`eos_nav_scr_create_keyed`创建的页面会放回缓存，之后可按同一 key 复用
  */
 eos_result_t eos_nav_back(void);
+/**
+ * @brief 立即提交未完成的导航操作（加载栈顶页面、删除出栈页面）
+ */
+void eos_nav_flush(void);
 
 #ifdef __cplusplus
 }
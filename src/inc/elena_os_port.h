@@ -81,11 +81,65 @@ void eos_bluetooth_disable(void);
  * @warning 请自行同步时间，确保获取的是准确时间
  */
 eos_datetime_t eos_time_get(void);
+/**
+ * @brief 获取单调递增的时间戳（微秒）
+ * @return uint64_t 时间戳
+ * @note 用于时间服务的相位计算与统计窗口，需与 LVGL 的时钟同步推进，
+ * 默认实现精度为 lv_tick_get 的 1ms，建议使用硬件定时器实现
+ */
+uint64_t eos_time_get_us(void);
+/**
+ * @brief 获取用于性能计时的时间戳（微秒）
+ * @return uint64_t 时间戳
+ * @note 用于启动阶段、渲染与 lv_timer_handler 耗时及性能追踪，默认与 eos_time_get_us 相同。
+ * 模拟器中 eos_time_get_us 为模拟时间，此函数为真实时间
+ */
+uint64_t eos_perf_time_get_us(void);
+/**
+ * @brief 主循环空闲等待，直到超时或 eos_idle_wakeup 被调用
+ * @param ms 最长等待时间（毫秒）
+ * @return true 被 eos_idle_wakeup 唤醒
+ * @return false 超时
+ * @note 等待前已调用过 eos_idle_wakeup 时应立即返回（信号量语义）。
+ * 默认实现在 Linux 上使用条件变量，其他平台调用 eos_delay（不能提前唤醒），
+ * 建议使用 RTOS 信号量或低功耗等待指令实现
+ */
+bool eos_idle_wait(uint32_t ms);
+/**
+ * @brief 唤醒正在 eos_idle_wait 中等待的主循环
+ * @note 由输入驱动、传感器等在有新数据时调用，需可在中断与其他线程中调用
+ */
+void eos_idle_wakeup(void);
 /**
  * @brief 设置屏幕亮度
  * @param brightness 亮度值（0~100）
  */
 void eos_display_set_brightness(uint8_t brightness);
+/**
+ * @brief 获取电池电量
+ * @return uint8_t 电量百分比（0~100）
+ */
+uint8_t eos_battery_get_level(void);
+/**
+ * @brief 获取今日步数
+ * @return uint32_t 步数
+ */
+uint32_t eos_steps_get(void);
+/**
+ * @brief 将文件以只读方式映射到内存
+ * @param path 文件路径
+ * @param size 输出：映射长度（字节）
+ * @return const void* 映射地址，不支持映射时返回 NULL（调用者将回退为读取到内存）
+ * @note Linux 可使用 mmap，支持 XIP 的 MCU 可直接返回 Flash 中的地址
+ * @warning 映射期间文件不能被原地改写
+ */
+const void *eos_file_mmap(const char *path, size_t *size);
+/**
+ * @brief 解除 eos_file_mmap 建立的映射
+ * @param addr 映射地址
+ * @param size 映射长度（字节）
+ */
+void eos_file_munmap(const void *addr, size_t size);
 #ifdef __cplusplus
 }
 #endif
@@ -27,7 +27,9 @@ extern "C" {
  * 表盘位置：/.sys/wf/faces
  * 表盘数据：/.sys/wf/wf_data
  */
-#define EOS_SYS_DIR "/.sys/"
+#ifndef EOS_SYS_DIR
+#define EOS_SYS_DIR "/.sys/"               // 可在编译时覆盖（例如模拟器使用 "./.sys/"）
+#endif /* EOS_SYS_DIR */
 #define EOS_SYS_CONFIG_DIR EOS_SYS_DIR "config/"
 #define EOS_SYS_CONFIG_FILE_PATH EOS_SYS_CONFIG_DIR "cfg.json"
 
@@ -0,0 +1,77 @@
+/**
+ * @file elena_os_time.h
+ * @brief 时间服务（缓存 RTC 时间，在整秒 / 整分钟 / 跨天时通知订阅者）
+ * @author Sab1e
+ * @date 2025-10-09
+ */
+
+#ifndef ELENA_OS_TIME_H
+#define ELENA_OS_TIME_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ---------------------------------------------------*/
+#include <stdint.h>
+#include <stdbool.h>
+#include "elena_os_core.h"
+
+/* Public macros ----------------------------------------------*/
+
+/* Public typedefs --------------------------------------------*/
+/**
+ * @brief 订阅的时间单位
+ */
+typedef enum
+{
+    EOS_TIME_UNIT_SECOND = 0, // 每个整秒
+    EOS_TIME_UNIT_MINUTE,     // 每个整分钟
+    EOS_TIME_UNIT_DAY,        // 每天零点（日期变化）
+    EOS_TIME_UNIT_COUNT,
+} eos_time_unit_t;
+/**
+ * @brief 时间变化回调
+ * @param dt 当前时间
+ * @param user_data 订阅时传入的用户数据
+ */
+typedef void (*eos_time_cb_t)(const eos_datetime_t *dt, void *user_data);
+
+/* Public function prototypes --------------------------------*/
+/**
+ * @brief 初始化时间服务
+ */
+void eos_time_init(void);
+/**
+ * @brief 获取当前时间
+ * @return eos_datetime_t 当前时间
+ * @note 按单调时钟推算下一个整秒，之前返回缓存，每秒最多读取一次 RTC（eos_time_get）。
+ * 需要当前时间时应使用此函数而不是直接调用 eos_time_get
+ */
+eos_datetime_t eos_time_now(void);
+/**
+ * @brief 立即重新读取 RTC，并在下一次 lv_timer_handler 中通知订阅者
+ * @note 用于设置系统时间或从休眠恢复后
+ */
+void eos_time_refresh(void);
+/**
+ * @brief 订阅时间变化，在对应单位进位时回调
+ * @param unit 时间单位
+ * @param cb 回调函数
+ * @param user_data 用户数据
+ * @return eos_result_t 订阅结果
+ * @note 所有订阅共用一个定时器，只有存在秒级订阅时才每秒唤醒
+ */
+eos_result_t eos_time_subscribe(eos_time_unit_t unit, eos_time_cb_t cb, void *user_data);
+/**
+ * @brief 取消订阅
+ * @param cb 订阅时的回调函数
+ * @param user_data 订阅时的用户数据
+ * @note 可在回调中调用
+ */
+void eos_time_unsubscribe(eos_time_cb_t cb, void *user_data);
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ELENA_OS_TIME_H */
@@ -0,0 +1,94 @@
+/**
+ * @file elena_os_trace.h
+ * @brief 性能追踪（导出为 Chrome trace_event JSON，可在 Perfetto 中查看）
+ * @author Sab1e
+ * @date 2025-10-04
+ */
+
+#ifndef ELENA_OS_TRACE_H
+#define ELENA_OS_TRACE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ---------------------------------------------------*/
+#include <stdint.h>
+#include <stdbool.h>
+#include "elena_os_core.h"
+#include "elena_os_config.h"
+
+/* Public macros ----------------------------------------------*/
+/**
+ * @brief 追踪宏，未定义 EOS_USE_TRACE 时编译为空
+ * @note name 必须为字符串常量（记录中只保存指针）
+ *
+ * 示例：
+ *
+ * `EOS_TRACE_BEGIN("load"); ... EOS_TRACE_END("load");`
+ *
+ * `EOS_TRACE_SCOPE("cfg_get");` 在所在作用域结束时自动结束（需要 GCC / Clang）
+ */
+#ifdef EOS_USE_TRACE
+#define EOS_TRACE_BEGIN(name) eos_trace_record((name), EOS_TRACE_PHASE_BEGIN)
+#define EOS_TRACE_END(name) eos_trace_record((name), EOS_TRACE_PHASE_END)
+#define EOS_TRACE_INSTANT(name) eos_trace_record((name), EOS_TRACE_PHASE_INSTANT)
+#if defined(__GNUC__)
+#define _EOS_TRACE_CONCAT2(a, b) a##b
+#define _EOS_TRACE_CONCAT(a, b) _EOS_TRACE_CONCAT2(a, b)
+#define EOS_TRACE_SCOPE(name)                                                            \
+    const char *_EOS_TRACE_CONCAT(_eos_trace_scope_, __LINE__)                           \
+        __attribute__((cleanup(eos_trace_scope_end), unused)) = (EOS_TRACE_BEGIN(name), (name))
+#else
+#define EOS_TRACE_SCOPE(name) EOS_TRACE_INSTANT(name)
+#endif /* __GNUC__ */
+#else
+#define EOS_TRACE_BEGIN(name) ((void)0)
+#define EOS_TRACE_END(name) ((void)0)
+#define EOS_TRACE_INSTANT(name) ((void)0)
+#define EOS_TRACE_SCOPE(name) ((void)0)
+#endif /* EOS_USE_TRACE */
+
+/* Public typedefs --------------------------------------------*/
+/**
+ * @brief 记录类型（对应 trace_event 的 ph 字段）
+ */
+typedef enum
+{
+    EOS_TRACE_PHASE_BEGIN = 0,  // "B"
+    EOS_TRACE_PHASE_END,        // "E"
+    EOS_TRACE_PHASE_INSTANT,    // "i"
+} eos_trace_phase_t;
+
+/* Public function prototypes --------------------------------*/
+/**
+ * @brief 写入一条记录到当前线程的环形缓冲区
+ * @param name 名称（字符串常量）
+ * @param phase 记录类型
+ * @note 缓冲区满时覆盖最旧的记录，请使用 EOS_TRACE_* 宏调用
+ */
+void eos_trace_record(const char *name, eos_trace_phase_t phase);
+/**
+ * @brief EOS_TRACE_SCOPE 的作用域结束回调
+ */
+void eos_trace_scope_end(const char **name);
+/**
+ * @brief 暂停或恢复记录
+ * @note 导出前建议暂停，避免其他线程在导出期间覆盖记录
+ */
+void eos_trace_set_enabled(bool enabled);
+/**
+ * @brief 清空所有线程的记录
+ */
+void eos_trace_clear(void);
+/**
+ * @brief 将所有线程的记录导出为 Chrome trace_event JSON
+ * @param path 输出文件路径
+ * @return eos_result_t 结果，未启用 EOS_USE_TRACE 时返回 -EOS_FAILED
+ */
+eos_result_t eos_trace_dump(const char *path);
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ELENA_OS_TRACE_H */
@@ -18,6 +18,7 @@ extern "C" {
 #include <stddef.h>
 #include "elena_os_core.h"
 #include "elena_os_sys.h"
+#include "lvgl.h"
 
 /* Public macros ----------------------------------------------*/
 #define EOS_WATCHFACE_DIR EOS_SYS_DIR "wf/"
@@ -25,7 +26,9 @@ extern "C" {
 #define EOS_WATCHFACE_DATA_DIR EOS_WATCHFACE_DIR "wf_data/"
 #define EOS_WATCHFACE_MANIFEST_FILE_NAME "manifest.json"
 #define EOS_WATCHFACE_SNAPSHOT_FILE_NAME "snapshot.bin"
+#define EOS_WATCHFACE_THUMBNAIL_FILE_NAME "thumbnail.bin" // 自动生成的预览图，位于表盘数据目录
 #define EOS_WATCHFACE_SCRIPT_ENTRY_FILE_NAME "main.js"
+#define EOS_WATCHFACE_LAYOUT_FILE_NAME "watchface.json"
 /* Public typedefs --------------------------------------------*/
 
 /* Public function prototypes --------------------------------*/
@@ -59,6 +62,37 @@ eos_result_t eos_watchface_install(const char *eapk_path);
  * @return eos_result_t 卸载结果
  */
 eos_result_t eos_watchface_uninstall(const char *watchface_id);
+/**
+ * @brief 获取表盘列表使用的预览图路径
+ * @param buf 输出缓冲区
+ * @param size 缓冲区大小
+ * @param watchface_id 表盘 id
+ * @note 优先使用自动生成的缩略图，其次为安装包中的 snapshot.bin，都不存在时使用默认图标
+ */
+void eos_watchface_preview_path(char *buf, size_t size, const char *watchface_id);
+/**
+ * @brief 将对象渲染为表盘缩略图，保存到表盘数据目录
+ * @param watchface_id 表盘 id
+ * @param obj 已绘制表盘的对象（通常为屏幕）
+ * @return eos_result_t 结果
+ */
+eos_result_t eos_watchface_snapshot_capture(const char *watchface_id, lv_obj_t *obj);
+/**
+ * @brief 离屏渲染声明式表盘的一帧并生成缩略图
+ * @param watchface_id 表盘 id
+ * @return eos_result_t 结果，脚本表盘返回 EOS_FAILED（首次运行时由 eos_watchface_snapshot_schedule 生成）
+ */
+eos_result_t eos_watchface_snapshot_generate(const char *watchface_id);
+/**
+ * @brief 缩略图不存在时，在表盘运行后截取一帧生成缩略图
+ * @param watchface_id 表盘 id
+ * @param scr 表盘所在屏幕，仅在该屏幕处于活动状态时截取
+ */
+void eos_watchface_snapshot_schedule(const char *watchface_id, lv_obj_t *scr);
+/**
+ * @brief 取消尚未完成的缩略图截取
+ */
+void eos_watchface_snapshot_cancel(void);
 /**
  * @brief 初始化表盘系统
  * @return eos_result_t 初始化结果
@@ -0,0 +1,53 @@
+/**
+ * @file elena_os_watchface_cache.h
+ * @brief 表盘静态层缓存
+ * @author Sab1e
+ * @date 2025-09-21
+ */
+
+#ifndef ELENA_OS_WATCHFACE_CACHE_H
+#define ELENA_OS_WATCHFACE_CACHE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ---------------------------------------------------*/
+#include <stdint.h>
+#include <stdbool.h>
+#include "lvgl.h"
+
+/* Public macros ----------------------------------------------*/
+
+/* Public typedefs --------------------------------------------*/
+/**
+ * @brief 静态层构建回调
+ * @param cont 临时容器（屏幕大小），在其中创建静态对象
+ * @param user_data 用户数据
+ */
+typedef void (*eos_watchface_static_builder_t)(lv_obj_t *cont, void *user_data);
+
+/* Public function prototypes --------------------------------*/
+/**
+ * @brief 创建表盘静态层缓存
+ * @param parent 父对象
+ * @param builder 静态对象构建回调
+ * @param user_data 传给 builder 的用户数据，必须在静态层存续期间有效
+ * @return lv_obj_t* 显示缓存的图像对象，失败返回 NULL
+ * @note builder 创建的对象只渲染一次，随后被删除，仅保留一张屏幕大小的图像。
+ * 主题更新（EOS_EVENT_THEME_UPDATED）时自动重新生成，对象删除（切换表盘）时释放缓存。
+ * 静态层始终位于父对象的最底层，动态对象应在其上方创建。
+ */
+lv_obj_t *eos_watchface_static_layer_create(lv_obj_t *parent,
+                                            eos_watchface_static_builder_t builder,
+                                            void *user_data);
+/**
+ * @brief 使静态层缓存失效并立即重新生成
+ * @param layer eos_watchface_static_layer_create 返回的对象
+ */
+void eos_watchface_static_layer_invalidate(lv_obj_t *layer);
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ELENA_OS_WATCHFACE_CACHE_H */
@@ -0,0 +1,62 @@
+/**
+ * @file elena_os_watchface_layout.h
+ * @brief 声明式表盘（无需 JS 虚拟机）
+ * @author Sab1e
+ * @date 2025-09-20
+ */
+
+#ifndef ELENA_OS_WATCHFACE_LAYOUT_H
+#define ELENA_OS_WATCHFACE_LAYOUT_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ---------------------------------------------------*/
+#include <stdint.h>
+#include <stdbool.h>
+#include "lvgl.h"
+
+/* Public macros ----------------------------------------------*/
+#define EOS_WATCHFACE_LAYOUT_DIGITS_MAX 6   // 数字图层最多显示的位数
+#define EOS_WATCHFACE_LAYOUT_TEXT_MAX 32    // 文本图层格式化后的最大长度
+
+/* Public typedefs --------------------------------------------*/
+
+/* Public function prototypes --------------------------------*/
+/**
+ * @brief 判断表盘是否提供声明式布局文件
+ * @param watchface_id 表盘 id
+ * @return true 存在 watchface.json
+ * @return false 不存在
+ */
+bool eos_watchface_layout_exists(const char *watchface_id);
+/**
+ * @brief 解析表盘的 watchface.json 并使用原生对象绘制表盘
+ * @param parent 父对象（通常为 root_scr）
+ * @param watchface_id 表盘 id
+ * @return lv_obj_t* 表盘容器，失败返回 NULL
+ * @note 容器删除时自动释放定时器与图片资源
+ *
+ * 布局文件示例：
+ * {
+ *   "bg_color": "#000000",
+ *   "layers": [
+ *     { "type": "image", "src": "bg.bin" },
+ *     { "type": "image", "src": "hour.bin", "x": 227, "y": 80,
+ *       "pivot_x": 6, "pivot_y": 150, "bind": "hour_angle" },
+ *     { "type": "digits", "x": 120, "y": 300, "bind": "minute",
+ *       "digits": 2, "spacing": 2, "font": ["0.bin", "1.bin", ... , "9.bin"] },
+ *     { "type": "text", "x": 200, "y": 400, "color": "#FFFFFF",
+ *       "format": "%d%%", "bind": "battery" }
+ *   ]
+ * }
+ * 可用绑定：hour、minute、second、year、month、day、weekday、battery、steps、
+ * hour_angle、minute_angle、second_angle（角度单位为 0.1 度）
+ */
+lv_obj_t *eos_watchface_layout_create(lv_obj_t *parent, const char *watchface_id);
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ELENA_OS_WATCHFACE_LAYOUT_H */
@@ -77,6 +77,15 @@ typedef enum {
     SE_ERR_UNKNOWN               // 未知错误
 } script_engine_result_t;
 
+/**
+ * @brief 外部缓冲区释放回调
+ * @param buf 缓冲区指针
+ * @param size 缓冲区大小（字节）
+ * @param user_data 用户数据
+ * @note 当包装该缓冲区的 ArrayBuffer 被 GC 回收或 VM 清理时调用
+ */
+typedef void (*script_engine_buffer_free_cb_t)(void *buf, size_t size, void *user_data);
+
 /* Public function prototypes --------------------------------*/
 /**
  * @brief 向指定的JerryScript对象中添加参数 参数为数值型
@@ -146,6 +155,34 @@ bool script_engine_request_ready(void);
  */
 void script_engine_register_functions(const script_engine_func_entry_t* entry, const size_t funcs_count);
 
+/**
+ * @brief 将原生内存零拷贝地包装为 JS ArrayBuffer
+ * @param buf 原生缓冲区
+ * @param size 缓冲区大小（字节）
+ * @param free_cb 释放回调，为 NULL 时表示借用内存，VM 不会释放该缓冲区
+ * @param user_data 传给 free_cb 的用户数据
+ * @return jerry_value_t ArrayBuffer 对象，失败时返回异常值（调用者负责释放）
+ * @warning 借用内存时，调用者必须保证 JS 持有引用期间缓冲区有效，
+ * 或在缓冲区失效前调用 `jerry_arraybuffer_detach`
+ */
+jerry_value_t script_engine_arraybuffer_external(void *buf, size_t size,
+                                                 script_engine_buffer_free_cb_t free_cb,
+                                                 void *user_data);
+
+/**
+ * @brief 将原生内存零拷贝地包装为 JS TypedArray
+ * @param type TypedArray 类型，例如 JERRY_TYPEDARRAY_UINT8
+ * @param buf 原生缓冲区
+ * @param size 缓冲区大小（字节），必须为元素大小的整数倍
+ * @param free_cb 释放回调，为 NULL 时表示借用内存
+ * @param user_data 传给 free_cb 的用户数据
+ * @return jerry_value_t TypedArray 对象，失败时返回异常值（调用者负责释放）
+ */
+jerry_value_t script_engine_typedarray_external(jerry_typedarray_type_t type,
+                                                void *buf, size_t size,
+                                                script_engine_buffer_free_cb_t free_cb,
+                                                void *user_data);
+
 #ifdef __cplusplus
 }
 #endif
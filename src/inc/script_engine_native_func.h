@@ -24,6 +24,11 @@ extern "C" {
  * @brief 注册 Native 函数
  */
 void script_engine_register_natives();
+/**
+ * @brief 释放脚本持有的原生资源（时间订阅、canvas 缓冲区等）
+ * @note 需在 jerry_cleanup 之前调用
+ */
+void script_engine_natives_cleanup(void);
 
 #ifdef __cplusplus
 }
@@ -106,8 +106,8 @@ void eos_lang_set(language_id_t lang)
         break;
     }
 
-    // 使用事件广播系统刷新所有标签
-    eos_event_broadcast(LV_EVENT_REFRESH, NULL);
+    // 投递刷新事件，同一帧内多次切换只刷新一次标签
+    eos_event_post(LV_EVENT_REFRESH, NULL);
 
     EOS_LOG_D("LANG CHANGED");
 }
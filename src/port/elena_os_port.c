@@ -10,10 +10,27 @@
 // Includes
 #include <stdio.h>
 #include <stdlib.h>
+#if defined(__linux__)
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <errno.h>
+#include <pthread.h>
+#else
+#include "lvgl.h"
+#endif /* __linux__ */
 
 // Macros and Definitions
 
 // Variables
+#if defined(__linux__)
+static pthread_mutex_t idle_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t idle_cond;
+static pthread_once_t idle_once = PTHREAD_ONCE_INIT;
+static bool idle_pending = false;
+#endif /* __linux__ */
 
 // Function Implementations
 
@@ -62,8 +79,120 @@ EOS_WEAK eos_datetime_t eos_time_get(void)
     return dt;
 }
 
+EOS_WEAK uint64_t eos_time_get_us(void)
+{
+#if defined(__linux__)
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000ULL + (uint64_t)ts.tv_nsec / 1000ULL;
+#else
+    return (uint64_t)lv_tick_get() * 1000ULL;
+#endif /* __linux__ */
+}
+
+EOS_WEAK uint64_t eos_perf_time_get_us(void)
+{
+    return eos_time_get_us();
+}
+
+#if defined(__linux__)
+static void _idle_cond_init(void)
+{
+    pthread_condattr_t attr;
+    pthread_condattr_init(&attr);
+    pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+    pthread_cond_init(&idle_cond, &attr);
+    pthread_condattr_destroy(&attr);
+}
+#endif /* __linux__ */
+
+EOS_WEAK bool eos_idle_wait(uint32_t ms)
+{
+#if defined(__linux__)
+    pthread_once(&idle_once, _idle_cond_init);
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    ts.tv_sec += ms / 1000;
+    ts.tv_nsec += (long)(ms % 1000) * 1000000L;
+    if (ts.tv_nsec >= 1000000000L)
+    {
+        ts.tv_sec++;
+        ts.tv_nsec -= 1000000000L;
+    }
+    pthread_mutex_lock(&idle_lock);
+    int ret = 0;
+    while (!idle_pending && ret != ETIMEDOUT)
+    {
+        ret = pthread_cond_timedwait(&idle_cond, &idle_lock, &ts);
+    }
+    bool woken = idle_pending;
+    idle_pending = false;
+    pthread_mutex_unlock(&idle_lock);
+    return woken;
+#else
+    eos_delay(ms);
+    return false;
+#endif /* __linux__ */
+}
+
+EOS_WEAK void eos_idle_wakeup(void)
+{
+#if defined(__linux__)
+    pthread_once(&idle_once, _idle_cond_init);
+    pthread_mutex_lock(&idle_lock);
+    idle_pending = true;
+    pthread_cond_signal(&idle_cond);
+    pthread_mutex_unlock(&idle_lock);
+#endif /* __linux__ */
+}
+
 EOS_WEAK void eos_display_set_brightness(uint8_t brightness)
 {
     EOS_UNUSED(brightness);
     return;
+}
+
+EOS_WEAK uint8_t eos_battery_get_level(void)
+{
+    return 100;
+}
+
+EOS_WEAK uint32_t eos_steps_get(void)
+{
+    return 0;
+}
+
+EOS_WEAK const void *eos_file_mmap(const char *path, size_t *size)
+{
+#if defined(__linux__)
+    int fd = open(path, O_RDONLY);
+    if (fd == -1)
+        return NULL;
+    struct stat file_stat;
+    if (fstat(fd, &file_stat) == -1 || file_stat.st_size <= 0)
+    {
+        close(fd);
+        return NULL;
+    }
+    void *addr = mmap(NULL, file_stat.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd); // 映射建立后即可关闭文件描述符
+    if (addr == MAP_FAILED)
+        return NULL;
+    *size = file_stat.st_size;
+    return addr;
+#else
+    EOS_UNUSED(path);
+    EOS_UNUSED(size);
+    return NULL;
+#endif /* __linux__ */
+}
+
+EOS_WEAK void eos_file_munmap(const void *addr, size_t size)
+{
+#if defined(__linux__)
+    munmap((void *)addr, size);
+#else
+    EOS_UNUSED(addr);
+    EOS_UNUSED(size);
+#endif /* __linux__ */
 }
\ No newline at end of file
@@ -16,13 +16,21 @@
 #include "lv_bindings.h"
 #include "lv_bindings_misc.h"
 #include "elena_os_port.h"
+#include "elena_os_trace.h"
 #include "script_engine_nav.h"
 #include "script_engine_native_func.h"
 #include "elena_os_log.h"
 #include "elena_os_misc.h"
 #include "cJSON.h"
 // Macros and Definitions
-
+/**
+ * @brief 外部 ArrayBuffer 的所有权描述
+ */
+typedef struct
+{
+    script_engine_buffer_free_cb_t free_cb; /**< 释放回调，NULL 表示借用内存 */
+    void *user_data;                        /**< 回调的用户数据 */
+} external_buffer_t;
 // Variables
 static atomic_bool should_terminate = ATOMIC_VAR_INIT(false); // 请求终止脚本标志位
 static script_state_t script_state = SCRIPT_STATE_STOPPED;
@@ -84,6 +92,48 @@ static jerry_value_t _vm_exec_stop_callback(void *user_p)
 
     return jerry_undefined();
 }
+/**
+ * @brief ArrayBuffer 内存分配回调
+ *
+ * 超过紧凑分配上限的 ArrayBuffer 从大内存池中分配，
+ * arraybuffer_user_p 置空，用于和外部缓冲区区分
+ */
+static uint8_t *_arraybuffer_allocate_cb(jerry_arraybuffer_type_t buffer_type,
+                                         uint32_t buffer_size,
+                                         void **arraybuffer_user_p,
+                                         void *user_p)
+{
+    (void)buffer_type;
+    (void)user_p;
+    *arraybuffer_user_p = NULL;
+    return (uint8_t *)eos_malloc_large(buffer_size);
+}
+
+/**
+ * @brief ArrayBuffer 内存释放回调
+ */
+static void _arraybuffer_free_cb(jerry_arraybuffer_type_t buffer_type,
+                                 uint8_t *buffer_p,
+                                 uint32_t buffer_size,
+                                 void *arraybuffer_user_p,
+                                 void *user_p)
+{
+    (void)buffer_type;
+    (void)user_p;
+    external_buffer_t *ext = (external_buffer_t *)arraybuffer_user_p;
+    if (!ext)
+    {
+        // 由 _arraybuffer_allocate_cb 分配的内部缓冲区
+        eos_free_large(buffer_p);
+        return;
+    }
+    if (ext->free_cb)
+    {
+        ext->free_cb(buffer_p, buffer_size, ext->user_data);
+    }
+    lv_free(ext);
+}
+
 /**
  * @brief 请求停止当前脚本运行
  */
@@ -224,6 +274,7 @@ script_engine_result_t script_engine_get_manifest(const char *manifest_path, scr
 
 script_engine_result_t script_engine_run(script_pkg_t *script_package)
 {
+    EOS_TRACE_SCOPE("script_engine_run");
     if (script_package == NULL || script_package->script_str == NULL)
     {
         return -SE_ERR_NULL_PACKAGE;
@@ -252,6 +303,8 @@ script_engine_result_t script_engine_run(script_pkg_t *script_package)
 
     // 初始化停止回调
     jerry_halt_handler(16, _vm_exec_stop_callback, NULL);
+    // 接管 ArrayBuffer 的内存管理，以支持外部缓冲区的所有权回调
+    jerry_arraybuffer_allocator(_arraybuffer_allocate_cb, _arraybuffer_free_cb, NULL);
     jerry_log_set_level(JERRY_LOG_LEVEL_DEBUG);
     // 注册原生函数
     script_engine_register_natives();
@@ -288,6 +341,7 @@ script_engine_result_t script_engine_run(script_pkg_t *script_package)
             _script_engine_exception_handler("Script Runtime", result);
             jerry_value_free(parsed_code);
             jerry_value_free(result);
+            script_engine_natives_cleanup();
             jerry_cleanup();
             script_state = SCRIPT_STATE_STOPPED;
             return -SE_ERR_JERRY_EXCEPTION;
@@ -297,6 +351,7 @@ script_engine_result_t script_engine_run(script_pkg_t *script_package)
             // 执行成功
             jerry_value_free(parsed_code);
             jerry_value_free(result);
+            script_engine_natives_cleanup();
             jerry_cleanup();
             script_state = SCRIPT_STATE_STOPPED;
             return SE_OK;
@@ -307,6 +362,7 @@ script_engine_result_t script_engine_run(script_pkg_t *script_package)
         // 代码解析出错
         _script_engine_exception_handler("Script Parse", parsed_code);
         jerry_value_free(parsed_code);
+        script_engine_natives_cleanup();
         jerry_cleanup();
         script_state = SCRIPT_STATE_STOPPED;
         return -SE_ERR_INVALID_JS;
@@ -326,3 +382,73 @@ void script_engine_register_functions(const script_engine_func_entry_t *entry, c
     }
     jerry_value_free(global);
 }
+
+jerry_value_t script_engine_arraybuffer_external(void *buf, size_t size,
+                                                 script_engine_buffer_free_cb_t free_cb,
+                                                 void *user_data)
+{
+    if (!buf || size == 0 || size > UINT32_MAX)
+    {
+        return jerry_throw_sz(JERRY_ERROR_RANGE, "Invalid external buffer");
+    }
+
+    external_buffer_t *ext = (external_buffer_t *)lv_malloc(sizeof(external_buffer_t));
+    if (!ext)
+    {
+        return jerry_throw_sz(JERRY_ERROR_COMMON, "Out of memory");
+    }
+    ext->free_cb = free_cb;
+    ext->user_data = user_data;
+
+    jerry_value_t arraybuffer = jerry_arraybuffer_external((uint8_t *)buf, (jerry_length_t)size, ext);
+    if (jerry_value_is_exception(arraybuffer))
+    {
+        // 创建失败时 VM 不会接管所有权
+        lv_free(ext);
+    }
+    return arraybuffer;
+}
+
+jerry_value_t script_engine_typedarray_external(jerry_typedarray_type_t type,
+                                                void *buf, size_t size,
+                                                script_engine_buffer_free_cb_t free_cb,
+                                                void *user_data)
+{
+    size_t elem_size;
+    switch (type)
+    {
+    case JERRY_TYPEDARRAY_UINT8:
+    case JERRY_TYPEDARRAY_UINT8CLAMPED:
+    case JERRY_TYPEDARRAY_INT8:
+        elem_size = 1;
+        break;
+    case JERRY_TYPEDARRAY_UINT16:
+    case JERRY_TYPEDARRAY_INT16:
+        elem_size = 2;
+        break;
+    case JERRY_TYPEDARRAY_UINT32:
+    case JERRY_TYPEDARRAY_INT32:
+    case JERRY_TYPEDARRAY_FLOAT32:
+        elem_size = 4;
+        break;
+    case JERRY_TYPEDARRAY_FLOAT64:
+        elem_size = 8;
+        break;
+    default:
+        return jerry_throw_sz(JERRY_ERROR_TYPE, "Unsupported TypedArray type");
+    }
+    if (size % elem_size != 0)
+    {
+        return jerry_throw_sz(JERRY_ERROR_RANGE, "Buffer size is not a multiple of element size");
+    }
+
+    jerry_value_t arraybuffer = script_engine_arraybuffer_external(buf, size, free_cb, user_data);
+    if (jerry_value_is_exception(arraybuffer))
+    {
+        return arraybuffer;
+    }
+    jerry_value_t typedarray = jerry_typedarray_with_buffer_span(type, arraybuffer, 0,
+                                                                 (jerry_length_t)(size / elem_size));
+    jerry_value_free(arraybuffer);
+    return typedarray;
+}
@@ -12,6 +12,10 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <math.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
 #include "cJSON.h"
 #include "lvgl.h"
 #include "script_engine_core.h"
@@ -23,10 +27,85 @@
 #include "elena_os_misc.h"
 #include "elena_os_log.h"
 #include "elena_os_port.h"
+#include "elena_os_frame_stats.h"
+#include "elena_os_time.h"
+#include "elena_os_idle.h"
+#include "elena_os_event.h"
 // Macros and Definitions
-
+#define BATCH_PROP_MAX_PAIRS 64    // 单次批量设置支持的最大属性数量
+#define JS_TIME_SUBS_MAX 8         // 单个脚本最多的时间订阅数量
+/**
+ * @brief 批量设置的属性 ID
+ *
+ * 样式属性以 `BATCH_PROP_STYLE_BASE + batch_style_props 索引` 编码
+ */
+typedef enum
+{
+    BATCH_PROP_FLAG_ADD = 1,
+    BATCH_PROP_FLAG_REMOVE,
+    BATCH_PROP_STATE_ADD,
+    BATCH_PROP_STATE_REMOVE,
+    BATCH_PROP_STYLE_BASE = 0x100,
+} batch_prop_id_t;
+/**
+ * @brief 可批量设置的样式属性
+ */
+typedef struct
+{
+    const char *name;     /**< 暴露给 JS 的名称 */
+    lv_style_prop_t prop; /**< LVGL 样式属性 */
+    bool is_color;        /**< 值为 0xRRGGBB 颜色 */
+} batch_style_prop_t;
+/**
+ * @brief 批量设置使用的样式，每个对象的每个选择器一个，对象删除时释放
+ */
+typedef struct
+{
+    lv_style_t style;
+    lv_style_selector_t selector;
+} batch_style_t;
+
+static const batch_style_prop_t batch_style_props[] = {
+    {"X", LV_STYLE_X, false},
+    {"Y", LV_STYLE_Y, false},
+    {"WIDTH", LV_STYLE_WIDTH, false},
+    {"HEIGHT", LV_STYLE_HEIGHT, false},
+    {"ALIGN", LV_STYLE_ALIGN, false},
+    {"PAD_TOP", LV_STYLE_PAD_TOP, false},
+    {"PAD_BOTTOM", LV_STYLE_PAD_BOTTOM, false},
+    {"PAD_LEFT", LV_STYLE_PAD_LEFT, false},
+    {"PAD_RIGHT", LV_STYLE_PAD_RIGHT, false},
+    {"PAD_ROW", LV_STYLE_PAD_ROW, false},
+    {"PAD_COLUMN", LV_STYLE_PAD_COLUMN, false},
+    {"RADIUS", LV_STYLE_RADIUS, false},
+    {"OPA", LV_STYLE_OPA, false},
+    {"BG_COLOR", LV_STYLE_BG_COLOR, true},
+    {"BG_OPA", LV_STYLE_BG_OPA, false},
+    {"BORDER_COLOR", LV_STYLE_BORDER_COLOR, true},
+    {"BORDER_OPA", LV_STYLE_BORDER_OPA, false},
+    {"BORDER_WIDTH", LV_STYLE_BORDER_WIDTH, false},
+    {"OUTLINE_WIDTH", LV_STYLE_OUTLINE_WIDTH, false},
+    {"SHADOW_WIDTH", LV_STYLE_SHADOW_WIDTH, false},
+    {"TEXT_COLOR", LV_STYLE_TEXT_COLOR, true},
+    {"TEXT_OPA", LV_STYLE_TEXT_OPA, false},
+    {"TEXT_ALIGN", LV_STYLE_TEXT_ALIGN, false},
+    {"IMAGE_RECOLOR", LV_STYLE_IMAGE_RECOLOR, true},
+    {"IMAGE_RECOLOR_OPA", LV_STYLE_IMAGE_RECOLOR_OPA, false},
+    {"TRANSFORM_ROTATION", LV_STYLE_TRANSFORM_ROTATION, false},
+    {"TRANSFORM_SCALE_X", LV_STYLE_TRANSFORM_SCALE_X, false},
+    {"TRANSFORM_SCALE_Y", LV_STYLE_TRANSFORM_SCALE_Y, false},
+};
+#define BATCH_STYLE_PROP_COUNT (sizeof(batch_style_props) / sizeof(batch_style_props[0]))
+/**
+ * @brief 脚本的时间订阅
+ */
+typedef struct
+{
+    jerry_value_t func; /**< 回调函数，空闲时为 0 */
+} js_time_sub_t;
 // Variables
 extern script_pkg_t script_pkg;
+static js_time_sub_t js_time_subs[JS_TIME_SUBS_MAX];
 
 // Function Implementations
 /********************************** 错误处理 **********************************/
@@ -181,12 +260,23 @@ jerry_value_t js_print_handler(const jerry_call_info_t *call_info_p,
 }
 /**
  * @brief Native 延时
+ *
+ * 脚本以 lv_timer_handler + delay 自行运行主循环，等待同样交给空闲管理：
+ * 广播其他线程投递的事件，输入与驱动事件可提前唤醒
  */
 jerry_value_t js_delay_handler(const jerry_call_info_t *call_info_p,
                                const jerry_value_t args_p[],
                                const jerry_length_t args_count)
 {
-    eos_delay(args_p[0]);
+    uint32_t ms = 0;
+    if (args_count > 0 && jerry_value_is_number(args_p[0]))
+    {
+        double val = jerry_value_as_number(args_p[0]);
+        ms = val > 0 ? (uint32_t)val : 0;
+    }
+    eos_event_dispatch_thread();
+    eos_idle_sleep(ms);
+    return jerry_undefined();
 }
 /**
  * @brief 在脚本专用的导航栈上创建新的 screen
@@ -570,24 +660,179 @@ static jerry_value_t js_config_get_number(const jerry_call_info_t *call_info_p,
     return ret;
 }
 
-// 返回时间对象给 JS
+/**
+ * @brief 创建 {year, month, day, hour, min, sec, day_of_week} 时间对象
+ */
+static jerry_value_t _datetime_to_js(const eos_datetime_t *dt)
+{
+    jerry_value_t obj = jerry_object();
+
+    script_engine_set_prop_number(obj, "year", dt->year);
+    script_engine_set_prop_number(obj, "month", dt->month);
+    script_engine_set_prop_number(obj, "day", dt->day);
+    script_engine_set_prop_number(obj, "hour", dt->hour);
+    script_engine_set_prop_number(obj, "min", dt->min);
+    script_engine_set_prop_number(obj, "sec", dt->sec);
+    script_engine_set_prop_number(obj, "day_of_week", dt->day_of_week);
+
+    return obj;
+}
+
+// 返回时间对象给 JS（使用时间服务的缓存，不直接读取 RTC）
 static jerry_value_t js_eos_time_get(const jerry_call_info_t *call_info_p,
                                      const jerry_value_t args[],
                                      const jerry_length_t argc)
 {
-    eos_datetime_t dt = eos_time_get();
+    eos_datetime_t dt = eos_time_now();
+    return _datetime_to_js(&dt);
+}
+
+static void _js_time_cb(const eos_datetime_t *dt, void *user_data)
+{
+    js_time_sub_t *sub = (js_time_sub_t *)user_data;
+    // 回调中可能取消订阅，调用期间持有一份引用
+    jerry_value_t func = jerry_value_copy(sub->func);
+    jerry_value_t this_val = jerry_undefined();
+    jerry_value_t arg = _datetime_to_js(dt);
+    jerry_value_t ret = jerry_call(func, this_val, &arg, 1);
+    if (jerry_value_is_exception(ret))
+    {
+        EOS_LOG_W("time_subscribe callback threw an exception");
+    }
+    jerry_value_free(ret);
+    jerry_value_free(arg);
+    jerry_value_free(this_val);
+    jerry_value_free(func);
+}
+
+static void _js_time_sub_release(js_time_sub_t *sub)
+{
+    eos_time_unsubscribe(_js_time_cb, sub);
+    jerry_value_free(sub->func);
+    sub->func = 0;
+}
 
-    // 创建 JS 对象
+/**
+ * @brief 订阅时间变化
+ * @param unit "second" / "minute" / "day"
+ * @param callback 回调函数，参数为与 eos_time_get 相同的时间对象
+ */
+static jerry_value_t js_time_subscribe(const jerry_call_info_t *call_info_p,
+                                       const jerry_value_t args[],
+                                       const jerry_length_t argc)
+{
+    if (argc < 2 || !jerry_value_is_string(args[0]) || !jerry_value_is_function(args[1]))
+    {
+        return throw_error("Usage: time_subscribe(unit, callback)");
+    }
+    char unit_str[8];
+    jerry_size_t unit_len = jerry_string_to_buffer(args[0], JERRY_ENCODING_UTF8,
+                                                   (jerry_char_t *)unit_str, sizeof(unit_str) - 1);
+    unit_str[unit_len] = '\0';
+    eos_time_unit_t unit;
+    if (strcmp(unit_str, "second") == 0)
+        unit = EOS_TIME_UNIT_SECOND;
+    else if (strcmp(unit_str, "minute") == 0)
+        unit = EOS_TIME_UNIT_MINUTE;
+    else if (strcmp(unit_str, "day") == 0)
+        unit = EOS_TIME_UNIT_DAY;
+    else
+        return throw_error("Unit must be \"second\", \"minute\" or \"day\"");
+
+    js_time_sub_t *sub = NULL;
+    for (uint32_t i = 0; i < JS_TIME_SUBS_MAX; i++)
+    {
+        if (!js_time_subs[i].func)
+        {
+            sub = &js_time_subs[i];
+            break;
+        }
+    }
+    if (!sub)
+    {
+        return throw_error("Too many time subscriptions");
+    }
+    sub->func = jerry_value_copy(args[1]);
+    if (eos_time_subscribe(unit, _js_time_cb, sub) != EOS_OK)
+    {
+        jerry_value_free(sub->func);
+        sub->func = 0;
+        return throw_error("Time subscribe failed");
+    }
+    return jerry_undefined();
+}
+
+/**
+ * @brief 取消时间订阅
+ * @param callback time_subscribe 时传入的回调函数
+ */
+static jerry_value_t js_time_unsubscribe(const jerry_call_info_t *call_info_p,
+                                         const jerry_value_t args[],
+                                         const jerry_length_t argc)
+{
+    if (argc < 1 || !jerry_value_is_function(args[0]))
+    {
+        return throw_error("Usage: time_unsubscribe(callback)");
+    }
+    for (uint32_t i = 0; i < JS_TIME_SUBS_MAX; i++)
+    {
+        if (!js_time_subs[i].func)
+            continue;
+        jerry_value_t same = jerry_binary_op(JERRY_BIN_OP_STRICT_EQUAL, js_time_subs[i].func, args[0]);
+        bool match = jerry_value_is_true(same);
+        jerry_value_free(same);
+        if (match)
+        {
+            _js_time_sub_release(&js_time_subs[i]);
+            break;
+        }
+    }
+    return jerry_undefined();
+}
+
+/**
+ * @brief 创建 {p50, p95, p99, max} 对象（单位 us）
+ */
+static jerry_value_t _frame_stats_dist_to_js(const eos_frame_stats_dist_t *dist)
+{
     jerry_value_t obj = jerry_object();
+    script_engine_set_prop_number(obj, "p50", dist->p50);
+    script_engine_set_prop_number(obj, "p95", dist->p95);
+    script_engine_set_prop_number(obj, "p99", dist->p99);
+    script_engine_set_prop_number(obj, "max", dist->max);
+    return obj;
+}
 
-    script_engine_set_prop_number(obj, "year", dt.year);
-    script_engine_set_prop_number(obj, "month", dt.month);
-    script_engine_set_prop_number(obj, "day", dt.day);
-    script_engine_set_prop_number(obj, "hour", dt.hour);
-    script_engine_set_prop_number(obj, "min", dt.min);
-    script_engine_set_prop_number(obj, "sec", dt.sec);
-    script_engine_set_prop_number(obj, "day_of_week", dt.day_of_week);
+// 返回帧统计对象给 JS
+static jerry_value_t js_frame_stats_get(const jerry_call_info_t *call_info_p,
+                                        const jerry_value_t args[],
+                                        const jerry_length_t argc)
+{
+    eos_frame_stats_t stats;
+    eos_frame_stats_get(&stats);
+
+    jerry_value_t obj = jerry_object();
+    script_engine_set_prop_number(obj, "fps", stats.fps);
+    script_engine_set_prop_number(obj, "cpu", stats.cpu);
+    script_engine_set_prop_number(obj, "frames", stats.frames);
 
+    const struct
+    {
+        const char *name;
+        const eos_frame_stats_dist_t *dist;
+    } dists[] = {
+        {"render", &stats.render},
+        {"handler", &stats.handler},
+        {"idle", &stats.idle},
+    };
+    for (size_t i = 0; i < sizeof(dists) / sizeof(dists[0]); i++)
+    {
+        jerry_value_t key = jerry_string_sz(dists[i].name);
+        jerry_value_t value = _frame_stats_dist_to_js(dists[i].dist);
+        jerry_value_free(jerry_object_set(obj, key, value));
+        jerry_value_free(value);
+        jerry_value_free(key);
+    }
     return obj;
 }
 
@@ -680,6 +925,498 @@ static jerry_value_t js_lv_tiny_ttf_create_file(const jerry_call_info_t *call_in
     return js_result;
 }
 
+/********************************** 零拷贝缓冲区 **********************************/
+/**
+ * @brief 从 JS 包装对象中取出 LVGL 对象指针
+ * @return 成功返回对象指针，参数无效则返回 NULL
+ */
+static void *_js_get_native_ptr(const jerry_value_t js_obj)
+{
+    if (!jerry_value_is_object(js_obj))
+    {
+        return NULL;
+    }
+    jerry_value_t ptr_prop = jerry_string_sz("__ptr");
+    jerry_value_t ptr_val = jerry_object_get(js_obj, ptr_prop);
+    jerry_value_free(ptr_prop);
+    if (!jerry_value_is_number(ptr_val))
+    {
+        jerry_value_free(ptr_val);
+        return NULL;
+    }
+    uintptr_t ptr = (uintptr_t)jerry_value_as_number(ptr_val);
+    jerry_value_free(ptr_val);
+    return (void *)ptr;
+}
+
+/**
+ * @brief 释放由 eos_malloc_large 分配的外部缓冲区
+ */
+static void _large_buffer_free_cb(void *buf, size_t size, void *user_data)
+{
+    EOS_UNUSED(size);
+    EOS_UNUSED(user_data);
+    eos_free_large(buf);
+}
+
+/**
+ * @brief 将脚本包 assets 目录下的文件整体读入内存，以 ArrayBuffer 形式返回
+ * @param name 文件名（相对于 assets 目录）
+ * @return ArrayBuffer 文件内容，由 GC 负责释放，不产生额外拷贝
+ */
+static jerry_value_t js_assets_read_buffer(const jerry_call_info_t *call_info_p,
+                                           const jerry_value_t args[],
+                                           const jerry_length_t argc)
+{
+    if (argc < 1 || !jerry_value_is_string(args[0]))
+    {
+        return throw_error("Usage: assets_read_buffer(name)");
+    }
+    if (script_pkg.id == NULL)
+    {
+        return throw_error("Script package info is NULL");
+    }
+
+    char name[PATH_MAX];
+    jerry_size_t name_len = jerry_string_to_buffer(args[0], JERRY_ENCODING_UTF8,
+                                                   (jerry_char_t *)name, sizeof(name) - 1);
+    name[name_len] = '\0';
+
+    char file_path[PATH_MAX];
+    if (script_pkg.type == SCRIPT_TYPE_APPLICATION)
+    {
+        snprintf(file_path, sizeof(file_path), EOS_APP_INSTALLED_DIR "%s/assets/%s",
+                 script_pkg.id, name);
+    }
+    else if (script_pkg.type == SCRIPT_TYPE_WATCHFACE)
+    {
+        snprintf(file_path, sizeof(file_path), EOS_WATCHFACE_INSTALLED_DIR "%s/assets/%s",
+                 script_pkg.id, name);
+    }
+    else
+    {
+        return throw_error("Unknown script type");
+    }
+
+    int fd = open(file_path, O_RDONLY);
+    if (fd == -1)
+    {
+        return throw_error("Open file failed");
+    }
+    struct stat file_stat;
+    if (fstat(fd, &file_stat) == -1 || file_stat.st_size <= 0)
+    {
+        close(fd);
+        return throw_error("Invalid file size");
+    }
+    size_t size = (size_t)file_stat.st_size;
+    void *buf = eos_malloc_large(size);
+    if (!buf)
+    {
+        close(fd);
+        return throw_error("Out of memory");
+    }
+    ssize_t bytes_read = read(fd, buf, size);
+    close(fd);
+    if (bytes_read != (ssize_t)size)
+    {
+        eos_free_large(buf);
+        return throw_error("Read file failed");
+    }
+
+    // 所有权移交给 VM，GC 时通过 _large_buffer_free_cb 释放
+    return script_engine_arraybuffer_external(buf, size, _large_buffer_free_cb, NULL);
+}
+
+/**
+ * @brief 借用 canvas 绘制缓冲区的 ArrayBuffer 与 canvas 的绑定关系
+ */
+typedef struct canvas_buffer_ref
+{
+    jerry_value_t arraybuffer;      /**< 借用缓冲区的 ArrayBuffer */
+    lv_obj_t *canvas;               /**< 缓冲区所属的 canvas，删除后置空 */
+    void *data;                     /**< 借用的缓冲区地址，canvas 更换缓冲区后重新创建 */
+    struct canvas_buffer_ref *next; /**< 存活绑定链表 */
+} canvas_buffer_ref_t;
+
+static canvas_buffer_ref_t *canvas_buffer_refs = NULL; // 每个 canvas 至多一个
+
+/**
+ * @brief 使 ArrayBuffer 失效并释放绑定
+ * @note detach 会触发 _canvas_buffer_free_cb 并释放 ref，此后不可再访问 ref
+ */
+static void _canvas_buffer_ref_release(canvas_buffer_ref_t *ref)
+{
+    jerry_value_t arraybuffer = ref->arraybuffer;
+    jerry_value_t ret = jerry_arraybuffer_detach(arraybuffer);
+    jerry_value_free(ret);
+    jerry_value_free(arraybuffer);
+}
+
+/**
+ * @brief canvas 删除时使借用其绘制缓冲区的 ArrayBuffer 失效
+ */
+static void _canvas_buffer_delete_cb(lv_event_t *e)
+{
+    canvas_buffer_ref_t *ref = (canvas_buffer_ref_t *)lv_event_get_user_data(e);
+    EOS_CHECK_PTR_RETURN(ref);
+    ref->canvas = NULL;
+    _canvas_buffer_ref_release(ref);
+}
+
+/**
+ * @brief VM 释放借用 canvas 缓冲区的 ArrayBuffer 时解除与 canvas 的绑定
+ */
+static void _canvas_buffer_free_cb(void *buf, size_t size, void *user_data)
+{
+    EOS_UNUSED(buf);
+    EOS_UNUSED(size);
+    canvas_buffer_ref_t *ref = (canvas_buffer_ref_t *)user_data;
+    for (canvas_buffer_ref_t **pp = &canvas_buffer_refs; *pp; pp = &(*pp)->next)
+    {
+        if (*pp == ref)
+        {
+            *pp = ref->next;
+            break;
+        }
+    }
+    if (ref->canvas && lv_obj_is_valid(ref->canvas))
+    {
+        lv_obj_remove_event_cb_with_user_data(ref->canvas, _canvas_buffer_delete_cb, ref);
+    }
+    lv_free(ref);
+}
+
+/**
+ * @brief 以 Uint8Array 直接访问 canvas 的像素缓冲区（零拷贝）
+ * @param canvas canvas 对象
+ * @return Uint8Array 借用 canvas 绘制缓冲区的视图，canvas 删除后自动失效
+ * @note 写入后需调用 lv_obj_invalidate 刷新显示；同一 canvas 多次调用共享同一个 ArrayBuffer
+ */
+static jerry_value_t js_lv_canvas_get_buffer(const jerry_call_info_t *call_info_p,
+                                             const jerry_value_t args[],
+                                             const jerry_length_t argc)
+{
+    if (argc < 1)
+    {
+        return throw_error("Insufficient arguments");
+    }
+    lv_obj_t *canvas = (lv_obj_t *)_js_get_native_ptr(args[0]);
+    if (!canvas || !lv_obj_is_valid(canvas) || !lv_obj_check_type(canvas, &lv_canvas_class))
+    {
+        return throw_error("Argument 0 must be a canvas");
+    }
+    lv_draw_buf_t *draw_buf = lv_canvas_get_draw_buf(canvas);
+    if (!draw_buf || !draw_buf->data)
+    {
+        return throw_error("Canvas has no buffer");
+    }
+
+    canvas_buffer_ref_t *ref = canvas_buffer_refs;
+    while (ref && ref->canvas != canvas)
+    {
+        ref = ref->next;
+    }
+    if (ref && ref->data != draw_buf->data)
+    {
+        // canvas 更换了缓冲区，旧的视图失效
+        _canvas_buffer_ref_release(ref);
+        ref = NULL;
+    }
+    if (ref)
+    {
+        return jerry_typedarray_with_buffer(JERRY_TYPEDARRAY_UINT8, ref->arraybuffer);
+    }
+
+    ref = (canvas_buffer_ref_t *)lv_malloc(sizeof(canvas_buffer_ref_t));
+    if (!ref)
+    {
+        return throw_error("Out of memory");
+    }
+    ref->canvas = canvas;
+    ref->data = draw_buf->data;
+    ref->arraybuffer = script_engine_arraybuffer_external(draw_buf->data, draw_buf->data_size,
+                                                          _canvas_buffer_free_cb, ref);
+    if (jerry_value_is_exception(ref->arraybuffer))
+    {
+        jerry_value_t err = ref->arraybuffer;
+        lv_free(ref);
+        return err;
+    }
+    ref->next = canvas_buffer_refs;
+    canvas_buffer_refs = ref;
+    jerry_value_t typedarray = jerry_typedarray_with_buffer(JERRY_TYPEDARRAY_UINT8, ref->arraybuffer);
+    // ref 持有 ArrayBuffer 的引用，canvas 删除或脚本退出时将其 detach，避免 JS 访问已释放的内存
+    lv_obj_add_event_cb(canvas, _canvas_buffer_delete_cb, LV_EVENT_DELETE, ref);
+    return typedarray;
+}
+
+/********************************** 批量属性设置 **********************************/
+/**
+ * @brief 对象删除时释放其批量样式
+ */
+static void _batch_style_delete_cb(lv_event_t *e)
+{
+    batch_style_t *bs = (batch_style_t *)lv_event_get_user_data(e);
+    EOS_CHECK_PTR_RETURN(bs);
+    lv_style_reset(&bs->style);
+    lv_free(bs);
+}
+
+/**
+ * @brief 查找对象在指定选择器上的批量样式
+ */
+static batch_style_t *_batch_style_find(lv_obj_t *obj, lv_style_selector_t selector)
+{
+    uint32_t event_cnt = lv_obj_get_event_count(obj);
+    for (uint32_t i = 0; i < event_cnt; i++)
+    {
+        lv_event_dsc_t *dsc = lv_obj_get_event_dsc(obj, i);
+        if (lv_event_dsc_get_cb(dsc) != _batch_style_delete_cb)
+            continue;
+        batch_style_t *bs = (batch_style_t *)lv_event_dsc_get_user_data(dsc);
+        if (bs && bs->selector == selector)
+            return bs;
+    }
+    return NULL;
+}
+
+/**
+ * @brief 读取描述符数组
+ *
+ * 支持普通数组与 Int32Array，Int32Array 直接读取底层缓冲区，不逐个跨越边界取值
+ * @return 成功返回读取到的元素数量，失败返回 -1
+ */
+static int32_t _batch_read_descriptor(const jerry_value_t desc, int32_t *out, uint32_t out_max)
+{
+    if (jerry_value_is_typedarray(desc) &&
+        jerry_typedarray_type(desc) == JERRY_TYPEDARRAY_INT32)
+    {
+        jerry_length_t byte_offset = 0;
+        jerry_length_t byte_length = 0;
+        jerry_value_t arraybuffer = jerry_typedarray_buffer(desc, &byte_offset, &byte_length);
+        uint8_t *data = jerry_arraybuffer_data(arraybuffer);
+        jerry_value_free(arraybuffer);
+        uint32_t count = byte_length / sizeof(int32_t);
+        if (!data || count > out_max)
+        {
+            return -1;
+        }
+        memcpy(out, data + byte_offset, count * sizeof(int32_t));
+        return (int32_t)count;
+    }
+
+    if (!jerry_value_is_array(desc))
+    {
+        return -1;
+    }
+    uint32_t count = jerry_array_length(desc);
+    if (count > out_max)
+    {
+        return -1;
+    }
+    for (uint32_t i = 0; i < count; i++)
+    {
+        jerry_value_t item = jerry_object_get_index(desc, i);
+        if (!jerry_value_is_number(item) || !isfinite(jerry_value_as_number(item)))
+        {
+            jerry_value_free(item);
+            return -1;
+        }
+        // 按 ToInt32 取值，0xAARRGGBB 等超过 INT32_MAX 的颜色保留原有位
+        out[i] = jerry_value_as_int32(item);
+        jerry_value_free(item);
+    }
+    return (int32_t)count;
+}
+
+/**
+ * @brief 对单个对象应用批量属性
+ * @return false 样式分配失败
+ */
+static bool _batch_apply(lv_obj_t *obj, const int32_t *desc, int32_t count,
+                         const lv_style_prop_t *style_props, const lv_style_value_t *style_values,
+                         uint32_t style_count, lv_style_selector_t selector)
+{
+    for (int32_t i = 0; i < count; i += 2)
+    {
+        int32_t value = desc[i + 1];
+        switch (desc[i])
+        {
+        case BATCH_PROP_FLAG_ADD:
+            lv_obj_add_flag(obj, (lv_obj_flag_t)value);
+            break;
+        case BATCH_PROP_FLAG_REMOVE:
+            lv_obj_remove_flag(obj, (lv_obj_flag_t)value);
+            break;
+        case BATCH_PROP_STATE_ADD:
+            lv_obj_add_state(obj, (lv_state_t)value);
+            break;
+        case BATCH_PROP_STATE_REMOVE:
+            lv_obj_remove_state(obj, (lv_state_t)value);
+            break;
+        default:
+            break;
+        }
+    }
+    if (!style_count)
+    {
+        return true;
+    }
+
+    // 所有样式属性写入同一个样式，每个对象只刷新一次样式与布局
+    batch_style_t *bs = _batch_style_find(obj, selector);
+    bool is_new = bs == NULL;
+    if (is_new)
+    {
+        bs = (batch_style_t *)lv_malloc(sizeof(batch_style_t));
+        if (!bs)
+        {
+            return false;
+        }
+        lv_style_init(&bs->style);
+        bs->selector = selector;
+    }
+    // 重复调用时原地更新，样式列表与事件列表不会增长
+    for (uint32_t i = 0; i < style_count; i++)
+    {
+        lv_style_set_prop(&bs->style, style_props[i], style_values[i]);
+    }
+    if (is_new)
+    {
+        lv_obj_add_style(obj, &bs->style, selector);
+        lv_obj_add_event_cb(obj, _batch_style_delete_cb, LV_EVENT_DELETE, bs);
+    }
+    else
+    {
+        lv_obj_refresh_style(obj, selector, LV_STYLE_PROP_ANY);
+    }
+    return true;
+}
+
+/**
+ * @brief 一次调用批量设置对象属性
+ * @param target LVGL 对象，或 LVGL 对象数组（对每个对象应用相同属性）
+ * @param desc 描述符数组 [id, value, id, value, ...]，id 取自全局 LV_PROP，支持 Int32Array
+ * @param selector 可选，样式选择器，默认为 0（LV_PART_MAIN | LV_STATE_DEFAULT）
+ * @note 样式属性写入对象在该选择器上的批量样式（重复调用原地更新），优先级低于对象的本地样式
+ */
+static jerry_value_t js_lv_obj_set_props(const jerry_call_info_t *call_info_p,
+                                         const jerry_value_t args[],
+                                         const jerry_length_t argc)
+{
+    if (argc < 2)
+    {
+        return throw_error("Usage: lv_obj_set_props(obj, [id, value, ...], selector)");
+    }
+
+    int32_t desc[BATCH_PROP_MAX_PAIRS * 2];
+    int32_t count = _batch_read_descriptor(args[1], desc, BATCH_PROP_MAX_PAIRS * 2);
+    if (count < 0 || (count & 1))
+    {
+        return throw_error("Invalid property descriptor");
+    }
+    lv_style_selector_t selector = 0;
+    if (argc > 2 && jerry_value_is_number(args[2]))
+    {
+        selector = (lv_style_selector_t)jerry_value_as_number(args[2]);
+    }
+
+    // 先校验并转换全部属性，避免只应用了一部分
+    lv_style_prop_t style_props[BATCH_PROP_MAX_PAIRS];
+    lv_style_value_t style_values[BATCH_PROP_MAX_PAIRS];
+    uint32_t style_count = 0;
+    for (int32_t i = 0; i < count; i += 2)
+    {
+        int32_t id = desc[i];
+        if (id >= BATCH_PROP_STYLE_BASE)
+        {
+            if ((uint32_t)(id - BATCH_PROP_STYLE_BASE) >= BATCH_STYLE_PROP_COUNT)
+            {
+                return throw_error("Unknown style property");
+            }
+            const batch_style_prop_t *p = &batch_style_props[id - BATCH_PROP_STYLE_BASE];
+            lv_style_value_t v;
+            if (p->is_color)
+            {
+                v.color = lv_color_hex((uint32_t)desc[i + 1]);
+            }
+            else
+            {
+                v.num = desc[i + 1];
+            }
+            style_props[style_count] = p->prop;
+            style_values[style_count] = v;
+            style_count++;
+        }
+        else if (id < BATCH_PROP_FLAG_ADD || id > BATCH_PROP_STATE_REMOVE)
+        {
+            return throw_error("Unknown property");
+        }
+    }
+
+    uint32_t applied = 0;
+    bool oom = false;
+    if (jerry_value_is_array(args[0]))
+    {
+        uint32_t len = jerry_array_length(args[0]);
+        for (uint32_t i = 0; i < len; i++)
+        {
+            jerry_value_t item = jerry_object_get_index(args[0], i);
+            lv_obj_t *obj = (lv_obj_t *)_js_get_native_ptr(item);
+            jerry_value_free(item);
+            if (obj && lv_obj_is_valid(obj))
+            {
+                oom |= !_batch_apply(obj, desc, count, style_props, style_values, style_count, selector);
+                applied++;
+            }
+        }
+    }
+    else
+    {
+        lv_obj_t *obj = (lv_obj_t *)_js_get_native_ptr(args[0]);
+        if (obj && lv_obj_is_valid(obj))
+        {
+            oom |= !_batch_apply(obj, desc, count, style_props, style_values, style_count, selector);
+            applied++;
+        }
+    }
+
+    if (oom)
+    {
+        return throw_error("Out of memory");
+    }
+    if (applied == 0)
+    {
+        return throw_error("Argument 0 must be an object or an array of objects");
+    }
+    return jerry_number(applied);
+}
+
+/**
+ * @brief 创建全局 LV_PROP 常量对象，供 lv_obj_set_props 使用
+ */
+static void _register_batch_prop_ids(void)
+{
+    jerry_value_t props = jerry_object();
+    script_engine_set_prop_number(props, "FLAG_ADD", BATCH_PROP_FLAG_ADD);
+    script_engine_set_prop_number(props, "FLAG_REMOVE", BATCH_PROP_FLAG_REMOVE);
+    script_engine_set_prop_number(props, "STATE_ADD", BATCH_PROP_STATE_ADD);
+    script_engine_set_prop_number(props, "STATE_REMOVE", BATCH_PROP_STATE_REMOVE);
+    for (uint32_t i = 0; i < BATCH_STYLE_PROP_COUNT; i++)
+    {
+        script_engine_set_prop_number(props, batch_style_props[i].name, BATCH_PROP_STYLE_BASE + i);
+    }
+
+    jerry_value_t global = jerry_current_realm();
+    jerry_value_t key = jerry_string_sz("LV_PROP");
+    jerry_value_t ret = jerry_object_set(global, key, props);
+    jerry_value_free(ret);
+    jerry_value_free(key);
+    jerry_value_free(global);
+    jerry_value_free(props);
+}
+
 /********************************** 注册原生函数 **********************************/
 
 /**
@@ -710,8 +1447,20 @@ const script_engine_func_entry_t script_engine_native_funcs[] = {
      .handler = js_config_get_number},
     {.name = "eos_time_get",
      .handler = js_eos_time_get},
+    {.name = "time_subscribe",
+     .handler = js_time_subscribe},
+    {.name = "time_unsubscribe",
+     .handler = js_time_unsubscribe},
+    {.name = "frame_stats_get",
+     .handler = js_frame_stats_get},
     {.name = "lv_tiny_ttf_create_file",
      .handler = js_lv_tiny_ttf_create_file},
+    {.name = "assets_read_buffer",
+     .handler = js_assets_read_buffer},
+    {.name = "lv_canvas_get_buffer",
+     .handler = js_lv_canvas_get_buffer},
+    {.name = "lv_obj_set_props",
+     .handler = js_lv_obj_set_props},
 };
 
 /**
@@ -720,4 +1469,24 @@ const script_engine_func_entry_t script_engine_native_funcs[] = {
 void script_engine_register_natives()
 {
     script_engine_register_functions(script_engine_native_funcs, sizeof(script_engine_native_funcs) / sizeof(script_engine_func_entry_t));
+    _register_batch_prop_ids();
+}
+
+/**
+ * @brief 释放脚本持有的原生资源（时间订阅、canvas 缓冲区等）
+ */
+void script_engine_natives_cleanup(void)
+{
+    for (uint32_t i = 0; i < JS_TIME_SUBS_MAX; i++)
+    {
+        if (js_time_subs[i].func)
+            _js_time_sub_release(&js_time_subs[i]);
+    }
+    // canvas 在 VM 销毁后才删除，提前解除绑定
+    while (canvas_buffer_refs)
+    {
+        canvas_buffer_ref_t *ref = canvas_buffer_refs;
+        canvas_buffer_refs = ref->next;
+        _canvas_buffer_ref_release(ref);
+    }
 }
@@ -10,149 +10,54 @@
 // Includes
 #include <stdio.h>
 #include <stdlib.h>
-#include <stdatomic.h>
 
 #include "elena_os_log.h"
+#include "elena_os_nav.h"
 #include "elena_os_basic_widgets.h"
+#include "elena_os_anim.h"
 // Macros and Definitions
-#define NAV_STACK_SIZE 32
-
-/**
- * @brief 导航栈结构体
- */
-typedef struct
-{
-    lv_obj_t *stack[NAV_STACK_SIZE]; /**< [0]: base_scr, [1]: root_scr, [2+]: other screens*/
-    int8_t top;
-    bool initialized;
-} script_nav_stack_t;
-
-/**
- * @brief 导航正忙，等待响应
- */
-#define NAV_BUSY_WAIT()                                                          \
-    do                                                                           \
-    {                                                                            \
-        bool expected = false;                                                   \
-        while (!atomic_compare_exchange_weak(&script_nav_busy, &expected, true)) \
-        {                                                                        \
-            expected = false;                                                    \
-            EOS_LOG_D("Waiting for script_nav stack to be available");           \
-            lv_timer_handler();                                                  \
-        }                                                                        \
-    } while (0)
-
-/**
- * @brief 导航正忙，取消操作
- */
-#define NAV_BUSY_CHECK()                                                        \
-    do                                                                          \
-    {                                                                           \
-        bool expected = false;                                                  \
-        if (!atomic_compare_exchange_strong(&script_nav_busy, &expected, true)) \
-        {                                                                       \
-            EOS_LOG_D("Nav stack busy, operation rejected");                    \
-            return -SE_ERR_BUSY;                                                \
-        }                                                                       \
-    } while (0)
 
 // Variables
-static script_nav_stack_t script_nav = {.top = -1, .initialized = false};
-static atomic_bool script_nav_busy = false; // 正在清除
+static lv_obj_t *script_root_scr = NULL; // 脚本的根页面，脚本页面与系统页面共用 eos_nav 导航栈
 extern script_pkg_t script_pkg;
 // Function Implementations
-static lv_obj_t *_script_nav_peek_prev(void);
-bool is_script_nav_stack_initialized(void);
-static bool _is_script_nav_stack_full(void);
-static bool _is_script_nav_stack_empty(void);
-script_engine_result_t script_engine_nav_back_clean(void);
-static script_engine_result_t _script_engine_nav_clear_stack(void);
 extern lv_style_t style_screen;
 /**
  * @brief 检查导航栈是否已初始化
  */
 bool is_script_nav_stack_initialized(void)
 {
-    return script_nav.initialized;
-}
-
-/**
- * @brief 检查导航栈是否已满
- */
-static bool _is_script_nav_stack_full(void)
-{
-    return script_nav.top >= NAV_STACK_SIZE - 1;
-}
-
-/**
- * @brief 检查导航栈是否为空
- */
-static bool _is_script_nav_stack_empty(void)
-{
-    return script_nav.top < 0;
-}
-
-/**
- * @brief 获取前一个页面对象
- */
-static lv_obj_t *_script_nav_peek_prev(void)
-{
-    EOS_LOG_D("NAV PREV");
-    return (script_nav.top > 0) ? script_nav.stack[script_nav.top - 1] : NULL;
+    return script_root_scr != NULL;
 }
 
 /**
- * @brief 清除整个导航栈
+ * @brief 创建带脚本页眉的页面
  */
-static script_engine_result_t _script_engine_nav_clear_stack(void)
+static lv_obj_t *_script_nav_scr_new(void)
 {
-    if (script_nav_busy)
-    {
-        EOS_LOG_E("Nav stack busy");
-        return -SE_ERR_BUSY;
-    }
-    atomic_store(&script_nav_busy, true);
-
-    if (!is_script_nav_stack_initialized())
-    {
-        EOS_LOG_E("Nav stack not initialized");
-        atomic_store(&script_nav_busy, false);
-        return -SE_ERR_NOT_INITIALIZED;
-    }
-
-    // 从栈顶向下清理所有非base_scr的screen
-    for (int i = script_nav.top; i >= 1; i--) // 从栈顶开始处理到索引1（跳过base_scr）
+    lv_obj_t *scr = lv_obj_create(NULL);
+    if (!scr)
     {
-        if (script_nav.stack[i] != NULL)
-        {
-            lv_obj_t *scr = script_nav.stack[i];
-            script_nav.stack[i] = NULL; // 清除指针
-            lv_obj_del(scr);            // 彻底删除screen
-            EOS_LOG_D("Cleared screen at stack position %d", i);
-        }
+        EOS_LOG_E("Create screen failed.");
+        return NULL;
     }
-
-    lv_obj_t *base_scr = script_nav.stack[0];
-
-    // 重置栈状态（只保留base_scr）
-    for (int i = 0; i < NAV_STACK_SIZE; i++)
+    lv_obj_add_style(scr, &style_screen, 0);
+    if (script_pkg.type == SCRIPT_TYPE_APPLICATION)
     {
-        script_nav.stack[i] = NULL;
+        eos_screen_bind_header(scr, script_pkg.name);
     }
-
-    // 加载base_scr
-    lv_scr_load(base_scr);
-    script_nav.top = -1;
-    script_nav.initialized = false;
-    atomic_store(&script_nav_busy, false);
-
-    EOS_LOG_D("Nav stack completely cleared. Only base screen remains");
-    return SE_OK;
+    return scr;
 }
 
 void script_engine_nav_clean_up()
 {
-    _script_engine_nav_clear_stack();
+    if (!is_script_nav_stack_initialized())
+        return;
+    // 弹出所有脚本页面并立即提交，脚本结束后不再残留页面
+    eos_nav_clear_owner(EOS_NAV_OWNER_SCRIPT);
+    eos_nav_flush();
+    script_root_scr = NULL;
+    EOS_LOG_D("Script screens cleared");
 }
 
 /**
@@ -175,34 +80,25 @@ script_engine_result_t script_engine_nav_init(lv_obj_t *base_scr)
     {
         script_engine_nav_clean_up();
     }
+    if (!eos_nav_is_initialized() && eos_nav_init(base_scr) != EOS_OK)
+    {
+        return -SE_ERR_NOT_INITIALIZED;
+    }
 
     // 创建root_scr（脚本的根页面）
-    lv_obj_t *root_scr = lv_obj_create(NULL);
+    lv_obj_t *root_scr = _script_nav_scr_new();
     if (!root_scr)
     {
-        EOS_LOG_E("Create root screen failed.");
         return -SE_ERR_MALLOC;
     }
-
-    // 初始化栈：stack[0] = base_scr, stack[1] = root_scr
-    script_nav.stack[0] = base_scr;
-    script_nav.stack[1] = root_scr;
-    script_nav.top = 1; // 栈顶索引为1
-    script_nav.initialized = true;
-
-    // 加载root_scr（脚本的根页面）
-    // lv_scr_load(root_scr);
-    if (script_pkg.type == SCRIPT_TYPE_APPLICATION)
+    if (eos_nav_push(root_scr, EOS_NAV_OWNER_SCRIPT, EOS_ANIM_SCR_LOAD_OVER_LEFT, 200) != EOS_OK)
     {
-        eos_screen_bind_header(root_scr, script_pkg.name);
-    }
-    lv_screen_load_anim(root_scr, LV_SCR_LOAD_ANIM_OVER_LEFT, 200, 0, false);
-    lv_obj_add_style(root_scr, &style_screen, 0);
-    uint32_t start = lv_tick_get();
-    while(lv_tick_elaps(start) < 200) {
-        lv_timer_handler();
-        lv_tick_inc(1);
+        lv_obj_del(root_scr);
+        return -SE_FAILED;
     }
+    script_root_scr = root_scr;
+    // 脚本随后立即执行顶层代码，此时根页面必须已是活动页面
+    eos_nav_flush();
     EOS_LOG_D("Nav stack initialized: base_scr=%p, root_scr=%p", base_scr, root_scr);
     return SE_OK;
 }
@@ -212,51 +108,22 @@ script_engine_result_t script_engine_nav_init(lv_obj_t *base_scr)
  */
 lv_obj_t *script_engine_nav_scr_create(void)
 {
-    if (script_nav_busy)
-    {
-        EOS_LOG_E("Nav stack busy");
-        return NULL;
-    }
-    atomic_store(&script_nav_busy, true);
-
     if (!is_script_nav_stack_initialized())
     {
         EOS_LOG_E("Nav stack not initialized");
         return NULL;
     }
-
-    if (_is_script_nav_stack_full())
-    {
-        EOS_LOG_E("Nav stack full");
-        return NULL;
-    }
-
-    lv_obj_t *scr = lv_obj_create(NULL);
+    lv_obj_t *scr = _script_nav_scr_new();
     if (!scr)
     {
-        EOS_LOG_E("Create screen failed.");
         return NULL;
     }
-    lv_obj_add_style(scr, &style_screen, 0);
-    if (script_pkg.type == SCRIPT_TYPE_APPLICATION)
-    {
-        eos_screen_bind_header(scr, script_pkg.name);
-    }
-    // 确保新屏幕与栈中已有屏幕地址不同
-    for (int i = 0; i <= script_nav.top; i++)
+    if (eos_nav_push(scr, EOS_NAV_OWNER_SCRIPT, EOS_ANIM_SCR_LOAD_NONE, 0) != EOS_OK)
     {
-        if (script_nav.stack[i] == scr)
-        {
-            EOS_LOG_E("New screen address conflicts with existing screen!");
-            lv_obj_del(scr);
-            return NULL;
-        }
+        lv_obj_del(scr);
+        return NULL;
     }
-
-    EOS_LOG_D("NAV PUSH: new screen at %p", scr);
-    script_nav.stack[++script_nav.top] = scr;
     EOS_MEM("Create new scr");
-    atomic_store(&script_nav_busy, false);
     return scr;
 }
 
@@ -265,60 +132,24 @@ lv_obj_t *script_engine_nav_scr_create(void)
  */
 script_engine_result_t script_engine_nav_back_clean(void)
 {
-    NAV_BUSY_CHECK();
-
     if (!is_script_nav_stack_initialized())
     {
         EOS_LOG_E("Nav stack not initialized");
-        atomic_store(&script_nav_busy, false);
         return -SE_ERR_NOT_INITIALIZED;
     }
 
-    if (_is_script_nav_stack_empty())
-    {
-        EOS_LOG_E("Nav stack empty (cannot back from root screen)");
-        atomic_store(&script_nav_busy, false);
-        return -SE_ERR_STACK_EMPTY;
-    }
-
-    // 如果当前在root_scr（top==1），则清理整个栈
-    if (script_nav.top == 1)
+    // 如果当前在root_scr，则停止脚本，由 script_engine_nav_clean_up 清理整个栈
+    if (eos_nav_top() == script_root_scr)
     {
-        // 停止脚本引擎
         if (script_engine_get_state() == SCRIPT_STATE_RUNNING)
         {
             script_engine_request_stop();
         }
         EOS_LOG_D("Back to base_scr and cleared root_scr");
-        EOS_MEM("Clear root_scr and back to base");
-        atomic_store(&script_nav_busy, false);
         return SE_OK;
     }
 
-    // 其他页面正常返回逻辑
-    lv_obj_t *prev_scr = _script_nav_peek_prev();
-    if (!prev_scr)
-    {
-        prev_scr = script_nav.stack[0]; // 回退到 base screen
-    }
-
-    // 保存要删除的页面
-    lv_obj_t *scr_to_del = script_nav.stack[script_nav.top];
-    script_nav.top--; // 更新栈指针
-
-    // 删除页面
-    if (scr_to_del)
-    {
-        lv_obj_del(scr_to_del);
-        EOS_LOG_D("Deleted screen at %p", scr_to_del);
-    }
-
-    // 加载前一个屏幕
-    lv_scr_load(prev_scr);
-
-    EOS_MEM("Clear scr");
-    atomic_store(&script_nav_busy, false);
-    return SE_OK;
+    return eos_nav_back_clean() == EOS_OK ? SE_OK : -SE_ERR_STACK_EMPTY;
 }
 
 /**
@@ -326,31 +157,17 @@ script_engine_result_t script_engine_nav_back_clean(void)
  */
 script_engine_result_t script_engine_nav_back(void)
 {
-    NAV_BUSY_CHECK();
-
     if (!is_script_nav_stack_initialized())
     {
         EOS_LOG_E("Nav stack not initialized");
-        atomic_store(&script_nav_busy, false);
         return -SE_ERR_NOT_INITIALIZED;
     }
 
-    if (_is_script_nav_stack_empty())
+    if (eos_nav_top() == script_root_scr)
     {
         EOS_LOG_E("Already at root screen, cannot go back");
-        atomic_store(&script_nav_busy, false);
         return -SE_ERR_STACK_EMPTY;
     }
 
-    lv_obj_t *prev_scr = _script_nav_peek_prev();
-    if (!prev_scr)
-    {
-        prev_scr = script_nav.stack[0]; // 回退到 base screen
-    }
-
-    script_nav.top--; // 更新栈指针
-    lv_scr_load(prev_scr);
-
-    atomic_store(&script_nav_busy, false);
-    return SE_OK;
+    return eos_nav_back() == EOS_OK ? SE_OK : -SE_ERR_STACK_EMPTY;
 }
\ No newline at end of file